@@ -180,6 +180,8 @@ str_str(char *target, size_t target_len, char *key, size_t key_len)
 	while (target_len >= key_len && (target = memchr(target, k, target_len))) {
 	    target_len = target_len - (size_t) (target - prior) - 1;
 	    prior = ++target;
+	    if (target_len == 0)
+		break;
 	    if (target[0] == k1) {
 		result = target - 1;
 		break;
@@ -192,6 +194,8 @@ str_str(char *target, size_t target_len, char *key, size_t key_len)
 	while (target_len > key_len && (target = memchr(target, k, target_len))) {
 	    target_len = target_len - (size_t) (target - prior) - 1;
 	    prior = ++target;
+	    if (target_len < key_len)
+		break;
 	    if (memcmp(target, key + 1, key_len) == 0) {
 		result = target - 1;
 		break;
@@ -294,42 +298,127 @@ bi_substr(CELL * sp)
     return sp;
 }
 
+/* set A[n SUBSEP name] to the number value */
+static void
+match_index(ARRAY A, int n, const char *name, double value)
+{
+    CELL key[2];
+    CELL *cp;
+
+    key[0].type = C_DOUBLE;
+    key[0].dval = (double) n;
+    key[1].type = C_STRING;
+    key[1].ptr = (PTR) new_STRING(name);
+    array_cat(key + 1, 2);
+    cp = array_find(A, key, CREATE);
+    free_STRING(string(key));
+    cell_destroy(cp);
+    cp->type = C_DOUBLE;
+    cp->dval = value;
+}
+
+/* set A[n], A[n, "start"] and A[n, "length"] to the len bytes at p in s */
+static void
+match_element(ARRAY A, int n, STRING * s, char *p, size_t len)
+{
+    CELL key;
+    CELL *cp;
+
+    key.type = C_DOUBLE;
+    key.dval = (double) n;
+    cp = array_find(A, &key, CREATE);
+    cell_destroy(cp);
+    cp->type = C_MBSTRN;
+    cp->ptr = (PTR) new_STRING1(p, len);
+    match_index(A, n, "start", (double) (p - s->str + 1));
+    match_index(A, n, "length", (double) len);
+}
+
 /*
-  match(s,r)
-  sp[0] holds r, sp[-1] holds s
+  match(s,r) and match(s,r,A)
+  sp[0] holds s, sp[1] holds r
+  A is 0 for match(s,r)
 */
-
-CELL *
-bi_match(CELL * sp)
+static void
+do_match(CELL * sp, ARRAY A)
 {
+    STRING *s;
     char *p;
     size_t length;
 
-    if (sp->type != C_RE)
-	cast_to_RE(sp);
-    if ((--sp)->type < C_STRING)
+    if ((sp + 1)->type != C_RE)
+	cast_to_RE(sp + 1);
+    if (sp->type < C_STRING)
 	cast1_to_s(sp);
+    s = string(sp);
 
     cell_destroy(RSTART);
     cell_destroy(RLENGTH);
     RSTART->type = C_DOUBLE;
     RLENGTH->type = C_DOUBLE;
 
-    p = REmatch(string(sp)->str, string(sp)->len, cast_to_re((sp + 1)->ptr), &length);
+    p = re_match((sp + 1)->ptr, RE_MATCH, s->str, s->len, &length);
 
     if (p) {
-	sp->dval = (double) (p - string(sp)->str + 1);
+	sp->dval = (double) (p - s->str + 1);
 	RLENGTH->dval = (double) length;
     } else {
 	sp->dval = 0.0;
 	RLENGTH->dval = -1.0;	/* posix */
     }
 
-    free_STRING(string(sp));
+    if (A != 0) {
+	array_clear(A);
+	if (p) {
+	    PTR groups = re_groups((sp + 1)->ptr);
+	    int count = REgroups_count(groups);
+
+	    match_element(A, 0, s, p, length);
+	    if (count > 0) {
+		size_t size = (size_t) count;
+		char **starts = (char **) zmalloc(size * sizeof(char *));
+		size_t *lens = (size_t *) zmalloc(size * sizeof(size_t));
+		int n;
+
+		REgroups_match(groups, s->str, s->len, p, length, starts, lens);
+		for (n = 0; n < count; ++n) {
+		    if (starts[n] != 0)
+			match_element(A, n + 1, s, starts[n], lens[n]);
+		}
+		zfree(starts, size * sizeof(char *));
+		zfree(lens, size * sizeof(size_t));
+	    }
+	}
+    }
+
+    free_STRING(s);
     sp->type = C_DOUBLE;
 
     RSTART->dval = sp->dval;
+}
+
+/*
+  match(s,r)
+  sp[0] holds r, sp[-1] holds s
+*/
 
+CELL *
+bi_match(CELL * sp)
+{
+    do_match(--sp, (ARRAY) 0);
+    return sp;
+}
+
+/*
+  match(s,r,A)
+  sp[0] points at A, sp[-1] holds r, sp[-2] holds s
+*/
+
+CELL *
+bi_match3(CELL * sp)
+{
+    sp -= 2;
+    do_match(sp, (ARRAY) (sp + 2)->ptr);
     return sp;
 }
 
@@ -643,9 +732,10 @@ bi_fflush(CELL * sp)
 {
     int ret = 0;
 
-    if (sp->type == 0)
+    if (sp->type == 0) {
+	passthru_flush();
 	fflush(stdout);
-    else {
+    } else {
 	sp--;
 	if (sp->type < C_STRING)
 	    cast1_to_s(sp);
@@ -843,7 +933,8 @@ bi_sub(CELL * sp)
 	cast1_to_s(&sc);
     front = string(&sc)->str;
 
-    if ((middle = REmatch(front, string(&sc)->len, cast_to_re(sp->ptr), &middle_len))) {
+    if ((middle = re_match(sp->ptr, RE_MATCH, front, string(&sc)->len,
+			   &middle_len))) {
 	front_len = (size_t) (middle - front);
 	back = middle + middle_len;
 	back_len = string(&sc)->len - front_len - middle_len;
@@ -886,315 +977,179 @@ bi_sub(CELL * sp)
     return sp;
 }
 
-typedef enum {
-    btFinish = 0,
-    btNormal,
-    btEmpty
-} GSUB_BT;
-
-typedef struct {
-    STRING *result;
-    CELL replace;
-    char *front;
-    char *middle;
-    char *target;
-    size_t front_len;
-    size_t middle_len;
-    size_t target_len;
-    int empty_ok;
-    GSUB_BT branch_to;
-} GSUB_STK;
-
-#define ThisGSUB       gsub_stk[level]
-#define ThisBranch     ThisGSUB.branch_to
-#define ThisEmptyOk    ThisGSUB.empty_ok
-#define ThisFront      ThisGSUB.front
-#define ThisFrontLen   ThisGSUB.front_len
-#define ThisMiddle     ThisGSUB.middle
-#define ThisMiddleLen  ThisGSUB.middle_len
-#define ThisReplace    ThisGSUB.replace
-#define ThisResult     ThisGSUB.result
-#define ThisTarget     ThisGSUB.target
-#define ThisTargetLen  ThisGSUB.target_len
-
-#define NextGSUB       gsub_stk[level + 1]
-#define NextBranch     NextGSUB.branch_to
-#define NextEmptyOk    NextGSUB.empty_ok
-#define NextFront      NextGSUB.front
-#define NextFrontLen   NextGSUB.front_len
-#define NextMiddle     NextGSUB.middle
-#define NextMiddleLen  NextGSUB.middle_len
-#define NextReplace    NextGSUB.replace
-#define NextResult     NextGSUB.result
-#define NextTarget     NextGSUB.target
-#define NextTargetLen  NextGSUB.target_len
-
-/* #define DEBUG_GSUB 1 */
-
-static size_t gsub_max;
-static GSUB_STK *gsub_stk;
-static unsigned repl_cnt;	/* number of global replacements */
-
-#if OPT_TRACE > 0
-static const char *
-indent(int level)
-{
-    static const char value[] = "-----------------";
-    const char *result;
-    int limit = (int) sizeof(value) - 1;
+/*
+ * gsub() builds its result here, growing it as needed, and copies it to a
+ * STRING once it is done.  A buffer larger than GSUB_KEEP is freed then,
+ * rather than held for the rest of the run.
+ */
+static char *gsub_buff;
+static size_t gsub_size;
+static size_t gsub_used;
 
-    if (level < limit)
-	result = value + limit - level;
-    else
-	result = "";
-    return result;
-}
+#ifdef NO_LEAKS
+#define GSUB_KEEP	0
+#else
+#define GSUB_KEEP	(64 * 1024)
 #endif
 
-/* recursive global subsitution
-   dealing with empty matches makes this mildly painful
-
-   repl is always of type REPL or REPLV, destroyed by caller
-   empty_ok is set if, match of empty string at front is OK
-*/
-
-#ifdef DEBUG_GSUB
-static STRING *
-old_gsub(PTR re, int level)
+static void
+gsub_append(const char *s, size_t len)
 {
-    char xbuff[2];
-    char *in_sval;
-    char *front = 0, *middle;
-    STRING *back;
-    size_t front_len, middle_len;
-
-    assert(level >= 0);
-    assert(level + 1 < (int) gsub_max);
-
-    middle = REmatch(ThisTarget, ThisTargetLen, cast_to_re(re), &middle_len);
-    if (middle != 0) {
-
-	if (!ThisEmptyOk && (middle_len == 0) && (middle == ThisTarget)) {
-	    /* match at front that's not allowed */
-
-	    front_len = 0;
-
-	    if (ThisTargetLen == 0) {	/* target is empty string */
-		null_str.ref_cnt++;
-		back = &null_str;
-	    } else if (isAnchored(re)) {
-		back = new_STRING1(ThisTarget, ThisTargetLen);
-	    } else {
-		/* make new repl with target[0] */
-		cellcpy(&NextReplace, &ThisReplace);
-		repl_destroy(&ThisReplace);
-		xbuff[0] = *ThisTarget;
-		xbuff[1] = 0;
-		ThisReplace.type = C_REPL;
-		ThisReplace.ptr = (PTR) new_STRING1(xbuff, 1);
-
-		NextTarget = ThisTarget + 1;
-		NextTargetLen = ThisTargetLen - 1;
-		NextEmptyOk = 1;
-		NextBranch = btEmpty;
-
-		back = old_gsub(re, level + 1);
-	    }
-	} else {		/* a match that counts */
-	    repl_cnt++;
-
-	    front = ThisTarget;
-	    front_len = (size_t) (middle - ThisTarget);
-
-	    if (front_len == ThisTargetLen) {	/* matched back of target */
-		back = &null_str;
-		null_str.ref_cnt++;
-	    } else {
-		NextTarget = middle + middle_len;
-		NextTargetLen = ThisTargetLen - (front_len + middle_len);
-		NextEmptyOk = 0;
-		NextBranch = btNormal;
-		cellcpy(&NextReplace, &ThisReplace);
-
-		back = old_gsub(re, level + 1);
-	    }
-
-	    /* patch the &'s if needed */
-	    if (ThisReplace.type == C_REPLV) {
-		STRING *sval = new_STRING1(middle, middle_len);
+    if (len == 0)
+	return;
+    if (gsub_used + len > gsub_size) {
+	size_t size = gsub_size ? gsub_size : 256;
+
+	while (size < gsub_used + len)
+	    size *= 2;
+	if (gsub_buff == 0)
+	    gsub_buff = (char *) zmalloc(size);
+	else
+	    gsub_buff = (char *) zrealloc(gsub_buff, gsub_size, size);
+	gsub_size = size;
+    }
+    memcpy(gsub_buff + gsub_used, s, len);
+    gsub_used += len;
+}
 
-		replv_to_repl(&ThisReplace, sval);
-		free_STRING(sval);
-	    }
+/* append the replacement for the len bytes matched at s */
+static void
+gsub_replace(CELL * repl, const char *s, size_t len)
+{
+    if (repl->type == C_REPL) {
+	gsub_append(string(repl)->str, string(repl)->len);
+    } else {
+	STRING **p = (STRING **) repl->ptr;
+	VCount cnt;
+
+	for (cnt = repl->vcnt; cnt; cnt--) {
+	    if (*p)
+		gsub_append((*p)->str, (*p)->len);
+	    else
+		gsub_append(s, len);
+	    p++;
 	}
+    }
+}
 
-	/* put the three pieces together */
-	ThisResult = new_STRING0(front_len + string(&ThisReplace)->len + back->len);
-	TRACE(("old %s front '%.*s', middle '%.*s', back '%.*s'\n",
-	       indent(level),
-	       front_len, front,
-	       string(&ThisReplace)->len, string(&ThisReplace)->str,
-	       back->len, back->str));
-	in_sval = ThisResult->str;
-
-	if (front_len) {
-	    memcpy(in_sval, front, front_len);
-	    in_sval += front_len;
-	}
-	if (string(&ThisReplace)->len) {
-	    memcpy(in_sval, string(&ThisReplace)->str, string(&ThisReplace)->len);
-	    in_sval += string(&ThisReplace)->len;
+/*
+ * Replace each match of re in target, searching forward from the end of the
+ * last one, so that the result is built in one pass over the target.  ^
+ * matches only at the start of the target.  An empty match is not allowed
+ * where the last match ended, so gsub(/x?/, "-") makes "abc" into "-a-b-c-".
+ * Return the number of replacements, leaving the result in gsub_buff.
+ */
+static unsigned
+gsub_scan(PTR re, CELL * repl, STRING * target)
+{
+    char *str = target->str;
+    size_t len = target->len;
+    char *end = str + len;
+    char *from = str;		/* where the search resumes */
+    char *middle;		/* the match */
+    size_t middle_len;
+    int empty_ok = 1;		/* an empty match at from is allowed */
+    unsigned count = 0;
+
+    gsub_used = 0;
+    middle = re_match(re, RE_MATCH, str, len, &middle_len);
+    while (middle != 0) {
+	if (middle_len == 0 && middle == from && !empty_ok) {
+	    /* step over a character, and try again after it */
+	    if (from == end)
+		break;
+	    gsub_append(from, (size_t) 1);
+	    from++;
+	    empty_ok = 1;
+	} else {
+	    count++;
+	    gsub_append(from, (size_t) (middle - from));
+	    gsub_replace(repl, middle, middle_len);
+	    from = middle + middle_len;
+	    empty_ok = 0;
 	}
-	if (back->len)
-	    memcpy(in_sval, back->str, back->len);
-
-	/* cleanup, repl is freed by the caller */
-	free_STRING(back);
-
-    } else {
-	/* no match */
-	ThisResult = new_STRING1(ThisTarget, ThisTargetLen);
+	TRACE(("gsub_scan %u replaced, resume at %lu\n",
+	       count, (unsigned long) (from - str)));
+	middle = re_match_resume(re, RE_MATCH, str, len, &middle_len,
+				 from, (char **) 0);
     }
-
-    return ThisResult;
+    gsub_append(from, (size_t) (end - from));
+    return count;
 }
-#endif /* DEBUG_GSUB */
 
-static STRING *
-new_gsub(PTR re, int level)
+/*
+ * gsub() of a regular expression which is a single string, which matches
+ * only where str_str() finds that string, never the empty string, and so
+ * always has the same replacement.  Count the matches, then copy the target
+ * into a result of the length that needs.
+ */
+static unsigned
+gsub_literal(CELL * cp, STRING * target, CELL * repl, char *key, size_t key_len)
 {
-    char xbuff[2];
-    char *in_sval;
-    STRING *back;
-
-  loop:
-    assert(level >= 0);
-    assert(level + 1 < (int) gsub_max);
-
-    ThisFront = 0;
-
-    ThisMiddle = REmatch(ThisTarget, ThisTargetLen, cast_to_re(re), &ThisMiddleLen);
-    if (ThisMiddle != 0) {
-
-	if (!ThisEmptyOk && (ThisMiddleLen == 0) && (ThisMiddle == ThisTarget)) {
-	    /* match at front that's not allowed */
-
-	    ThisFrontLen = 0;
-
-	    if (ThisTargetLen == 0) {	/* target is empty string */
-		null_str.ref_cnt++;
-		back = &null_str;
-	    } else if (isAnchored(re)) {
-		back = new_STRING1(ThisTarget, ThisTargetLen);
-	    } else {
-		/* make new repl with target[0] */
-		cellcpy(&NextReplace, &ThisReplace);
-		repl_destroy(&ThisReplace);
-		xbuff[0] = *ThisTarget;
-		xbuff[1] = 0;
-		ThisReplace.type = C_REPL;
-		ThisReplace.ptr = (PTR) new_STRING1(xbuff, 1);
-
-		NextTarget = ThisTarget + 1;
-		NextTargetLen = ThisTargetLen - 1;
-		NextEmptyOk = 1;
-		NextBranch = btEmpty;
-
-		++level;
-		goto loop;
-
-	      empty_match:
-		back = NextResult;
-	    }
-	} else {		/* a match that counts */
-	    repl_cnt++;
-
-	    ThisFront = ThisTarget;
-	    ThisFrontLen = (size_t) (ThisMiddle - ThisTarget);
-
-	    if (ThisFrontLen == ThisTargetLen) {	/* matched back of target */
-		back = &null_str;
-		null_str.ref_cnt++;
-	    } else {
-		NextTarget = ThisMiddle + ThisMiddleLen;
-		NextTargetLen = ThisTargetLen - (ThisFrontLen + ThisMiddleLen);
-		NextEmptyOk = 0;
-		NextBranch = btNormal;
-		cellcpy(&NextReplace, &ThisReplace);
-
-		++level;
-		goto loop;
-
-	      normal_match:
-		back = NextResult;
-	    }
+    CELL rc;			/* the replacement, with & expanded */
+    CELL tc;			/* build the result here */
+    char *s = target->str;
+    size_t left = target->len;
+    char *p;
+    char *q;
+    unsigned count = 0;
+    unsigned n;
+
+    while ((p = str_str(s, left, key, key_len)) != 0) {
+	++count;
+	left -= (size_t) (p - s) + key_len;
+	s = p + key_len;
+    }
 
-	    /* patch the &'s if needed */
-	    if (ThisReplace.type == C_REPLV) {
-		STRING *sval = new_STRING1(ThisMiddle, ThisMiddleLen);
+    if (count) {
+	cellcpy(&rc, repl);
+	if (rc.type == C_REPLV) {
+	    STRING *sval = new_STRING1(key, key_len);
 
-		replv_to_repl(&ThisReplace, sval);
-		free_STRING(sval);
-	    }
+	    replv_to_repl(&rc, sval);
+	    free_STRING(sval);
 	}
 
-	/* put the three pieces together */
-	ThisResult = new_STRING0(ThisFrontLen + string(&ThisReplace)->len + back->len);
-	TRACE(("new %s front '%.*s', middle '%.*s', back '%.*s'\n",
-	       indent(level),
-	       (int) ThisFrontLen, ThisFront,
-	       (int) string(&ThisReplace)->len, string(&ThisReplace)->str,
-	       (int) back->len, back->str));
-	in_sval = ThisResult->str;
-
-	if (ThisFrontLen) {
-	    memcpy(in_sval, ThisFront, ThisFrontLen);
-	    in_sval += ThisFrontLen;
-	}
-	if (string(&ThisReplace)->len) {
-	    memcpy(in_sval, string(&ThisReplace)->str, string(&ThisReplace)->len);
-	    in_sval += string(&ThisReplace)->len;
+	tc.type = C_STRING;
+	tc.ptr = (PTR) new_STRING0(target->len
+				   - count * key_len
+				   + count * string(&rc)->len);
+	q = string(&tc)->str;
+	s = target->str;
+	left = target->len;
+	for (n = count; n != 0; --n) {
+	    p = str_str(s, left, key, key_len);
+	    memcpy(q, s, (size_t) (p - s));
+	    q += p - s;
+	    memcpy(q, string(&rc)->str, string(&rc)->len);
+	    q += string(&rc)->len;
+	    left -= (size_t) (p - s) + key_len;
+	    s = p + key_len;
 	}
-	if (back->len)
-	    memcpy(in_sval, back->str, back->len);
+	memcpy(q, s, left);
 
-	/* cleanup, repl is freed by the caller */
-	free_STRING(back);
-	repl_destroy(&ThisReplace);
-
-    } else {
-	/* no match */
-	ThisResult = new_STRING1(ThisTarget, ThisTargetLen);
-	repl_destroy(&ThisReplace);
-    }
+	slow_cell_assign(cp, &tc);
 
-    switch (ThisBranch) {
-    case btEmpty:
-	--level;
-	goto empty_match;
-    case btNormal:
-	--level;
-	goto normal_match;
-    case btFinish:
-	break;
+	free_STRING(string(&tc));
+	repl_destroy(&rc);
     }
-
-    return ThisResult;
+    return count;
 }
 
-/* set up for call to gsub() */
+/* entry:  sp[0] = address of CELL to gsub on
+	   sp[-1] = substitution CELL
+	   sp[-2] = regular expression to match
+*/
+
 CELL *
 bi_gsub(CELL * sp)
 {
     CELL *cp;			/* pts at the replacement target */
     CELL sc;			/* copy of replacement target */
     CELL tc;			/* build the result here */
-    STRING *result;
-#ifdef DEBUG_GSUB
-    STRING *resul2;
-#endif
-    size_t stack_needs;
-    int level = 0;
+    char *key;			/* the string, if the regular expression is one */
+    unsigned key_len;
+    unsigned repl_cnt;		/* number of global replacements */
 
     sp -= 2;
     if (sp->type != C_RE)
@@ -1206,66 +1161,27 @@ bi_gsub(CELL * sp)
     if (sc.type < C_STRING)
 	cast1_to_s(&sc);
 
-    stack_needs = (string(&sc)->len + 2) * 2;
+    if ((key = is_string_split(cast_to_re(sp->ptr), &key_len)) != 0
+	&& key_len != 0) {
+	double start = re_profile_flag ? re_prof_start() : 0.0;
 
-    if (stack_needs > gsub_max) {
-	if (gsub_max) {
-	    zfree(gsub_stk, gsub_max * sizeof(GSUB_STK));
-	}
-	gsub_stk = zmalloc(stack_needs * sizeof(GSUB_STK));
-	gsub_max = stack_needs;
-    }
-#ifdef DEBUG_GSUB
-    {
-	STRING *target = new_STRING1(string(&sc)->str, string(&sc)->len);
-
-	ThisBranch = btFinish;
-	ThisEmptyOk = 1;
-	cellcpy(&ThisReplace, sp + 1);
-	ThisResult = 0;
-	ThisTarget = target->str;
-	ThisTargetLen = target->len;
-
-	resul2 = old_gsub(sp->ptr, 0);
-
-	TRACE(("OLD ->'%.*s'\n", resul2->len, resul2->str));
-	free_STRING(target);
-    }
-#endif
-
-    ThisBranch = btFinish;
-    ThisEmptyOk = 1;
-    cellcpy(&ThisReplace, sp + 1);
-    ThisResult = 0;
-    ThisTarget = string(&sc)->str;
-    ThisTargetLen = string(&sc)->len;
-
-    repl_cnt = 0;
-
-    result = new_gsub(sp->ptr, 0);
-    tc.ptr = (PTR) result;
-
-#ifdef DEBUG_GSUB
-    TRACE(("NEW ->'%.*s'\n", result->len, result->str));
-    if (result->len != resul2->len || memcmp(result->str, resul2->str, result->len))
-	TRACE(("OOPS\n"));
-#endif
-
-    if (repl_cnt) {
+	repl_cnt = gsub_literal(cp, string(&sc), sp + 1, key, (size_t) key_len);
+	if (re_profile_flag)
+	    re_prof_literal(sp->ptr, repl_cnt, string(&sc)->len, start);
+    } else if ((repl_cnt = gsub_scan(sp->ptr, sp + 1, string(&sc))) != 0) {
 	tc.type = C_STRING;
+	tc.ptr = (PTR) new_STRING1(gsub_buff, gsub_used);
 	slow_cell_assign(cp, &tc);
+	free_STRING(string(&tc));
     }
-#ifdef NO_LEAKS
-    if (gsub_stk != 0) {
-	zfree(gsub_stk, stack_needs * sizeof(GSUB_STK));
-	gsub_stk = 0;
-	gsub_max = 0;
+    if (gsub_size > GSUB_KEEP) {
+	zfree(gsub_buff, gsub_size);
+	gsub_buff = 0;
+	gsub_size = 0;
     }
-#endif
 
     /* cleanup */
     free_STRING(string(&sc));
-    free_STRING(string(&tc));
     repl_destroy(sp + 1);
 
     sp->type = C_DOUBLE;
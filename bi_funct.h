@@ -42,6 +42,7 @@ CELL *bi_substr(CELL *);
 CELL *bi_sprintf(CELL *);
 CELL *bi_split(CELL *);
 CELL *bi_match(CELL *);
+CELL *bi_match3(CELL *);
 CELL *bi_getline(CELL *);
 CELL *bi_sub(CELL *);
 CELL *bi_gsub(CELL *);
@@ -53,12 +53,15 @@ the GNU General Public License, version 2, 1991.
 #include "init.h"
 #include "jmp.h"
 #include "field.h"
+#include "repl.h"
 
 #ifdef NO_LEAKS
-#include "repl.h"
 #include "scan.h"
 #endif
 
+/* with fewer patterns than this, testing them one by one is as fast */
+#define RULES_MIN 6
+
 static CODEBLOCK *new_code(void);
 
 CODEBLOCK active_code;
@@ -147,6 +150,116 @@ code_init(void)
     code1(_OMAIN);
 }
 
+/*
+ * Find the patterns in the main block which test $0 against a regular
+ * expression, i.e., the _MATCH0's, saving their addresses if sites is not
+ * null.  The patterns of ranges are left alone.  Return the count.
+ */
+static int
+find_rules(INST ** sites)
+{
+    INST *p;
+    int count = 0;
+
+    for (p = main_start; p->op != _HALT;) {
+	switch ((MAWK_OPCODES) (p++)->op) {
+	case _MATCH0:
+	    if (sites != 0)
+		sites[count] = p - 1;
+	    ++count;
+	    p++;
+	    break;
+	case _RANGE:
+	    p += p[2].op;	/* to the action */
+	    break;
+	case _CALL:
+	case F_PUSHI:
+	    p += 2;
+	    break;
+	case AE_PUSHA:
+	case AE_PUSHI:
+	case A_CAT:
+	case A_PUSHA:
+	case ALOOP:
+	case F_PUSHA:
+	case LAE_PUSHA:
+	case LAE_PUSHI:
+	case LA_PUSHA:
+	case L_PUSHA:
+	case L_PUSHI:
+	case SET_ALOOP:
+	case _BUILTIN:
+	case _JMP:
+	case _JNZ:
+	case _JZ:
+	case _LJNZ:
+	case _LJZ:
+	case _MATCH1:
+	case _PRINT:
+	case _PUSHA:
+	case _PUSHC:
+	case _PUSHD:
+	case _PUSHI:
+	case _PUSHINT:
+	case _PUSHS:
+	    p++;
+	    break;
+	default:
+	    break;
+	}
+    }
+    return count;
+}
+
+/*
+ * Recode the _MATCH0's of the main block which re_rules() can test as a
+ * set to _MATCH0S.
+ */
+static void
+set_rules(void)
+{
+    INST **sites;
+    PTR *list;
+    int count;
+    int n;
+
+    if ((count = find_rules((INST **) 0)) < RULES_MIN)
+	return;
+
+    sites = (INST **) zmalloc((size_t) count * sizeof(INST *));
+    list = (PTR *) zmalloc((size_t) count * sizeof(PTR));
+    find_rules(sites);
+    for (n = 0; n < count; ++n)
+	list[n] = sites[n][1].ptr;
+
+    re_rules(list, count);
+    for (n = 0; n < count; ++n) {
+	if (list[n] != sites[n][1].ptr) {
+	    RE_RULE *rule = (RE_RULE *) list[n];
+
+	    if (sites[n][2].op == _JZ)
+		rule->fail = sites[n] + 3 + sites[n][3].op;
+	    sites[n][0].op = _MATCH0S;
+	    sites[n][1].ptr = list[n];
+	}
+    }
+
+    /* a pattern "/re/ { ... }" is coded as _MATCH0S, then _JZ to the next
+       pattern.  Find the runs of those, which re_rule_skip() skips */
+    for (n = count - 2; n >= 0; --n) {
+	RE_RULE *rule = (RE_RULE *) list[n];
+	RE_RULE *next = (RE_RULE *) list[n + 1];
+
+	if (sites[n][0].op == _MATCH0S
+	    && sites[n + 1][0].op == _MATCH0S
+	    && rule->fail == sites[n + 1]
+	    && next->fail != 0)
+	    rule->last = next->last;
+    }
+    zfree(sites, (size_t) count * sizeof(INST *));
+    zfree(list, (size_t) count * sizeof(PTR));
+}
+
 /* final code relocation
    set_code() as in set concrete */
 void
@@ -165,6 +278,7 @@ set_code(void)
 	main_start = code_shrink(main_code_p, &main_size);
 	next_label = main_start + gl_offset;
 	execution_start = main_start;
+	set_rules();
     } else {			/* only BEGIN */
 	zfree(code_base, INST_BYTES(PAGESZ));
 	code_base = 0;
@@ -314,6 +428,10 @@ free_codes(const char *tag, INST * base, size_t size)
 		++cdp;		/* skip pointer */
 		re_destroy(cdp->ptr);
 		break;
+	    case _MATCH0S:
+		++cdp;		/* skip pointer */
+		re_destroy(rule_to_re(cdp->ptr));
+		break;
 	    case LAE_PUSHA:
 	    case LA_PUSHA:
 	    case A_CAT:
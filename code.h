@@ -172,6 +172,7 @@ typedef enum {
     ,_GT
     ,_GTE
     ,_MATCH0
+    ,_MATCH0S
     ,_MATCH1
     ,_MATCH2
     ,_EXIT
@@ -222,6 +222,13 @@ da(INST * start, FILE *fp)
 	    p++;
 	    break;
 
+	case _MATCH0S:
+	    fprintf(fp, "match0s\t0x%lx\t/%s/\n",
+		    (long) rule_to_re(p->ptr),
+		    re_uncompile(rule_to_re(p->ptr)));
+	    p++;
+	    break;
+
 	case _PUSHA:
 	    fprintf(fp, "pusha\t%s\n",
 		    reverse_find(ST_VAR, &p++->ptr));
@@ -395,6 +402,7 @@ special_cases[] =
 {
    {bi_split,   "split"},
    {bi_match,   "match"},
+   {bi_match3,  "match"},
    {bi_getline, "getline"},
    {bi_sub,     "sub"},
    {bi_gsub,    "gsub"},
@@ -475,6 +483,7 @@ static OP_NAME other_codes[] = {
     { _LJNZ,      "ljnz" },
     { _LJZ,       "ljz" },
     { _MATCH0,    "match0" },
+    { _MATCH0S,   "match0s" },
     { _MATCH1,    "match1" },
     { _PUSHA,     "pusha" },
     { _PUSHC,     "pushc" },
@@ -310,13 +310,11 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	       cdp[0] holds & $i , cdp[1] holds i */
 
 	    inc_sp();
-	    if (nf < 0)
-		split_field0();
 	    cp = (CELL *) cdp->ptr;
 	    t = (cdp + 1)->op;
 	    cdp += 2;
 
-	    if (t <= nf)
+	    if (nf < 0 ? split_field0_to(t) : t <= nf)
 		cellcpy(sp, cp);
 	    else {		/* an unset field */
 		sp->type = C_STRING;
@@ -359,9 +357,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 
 	    t = d_to_index(sp->dval);
 
-	    if (nf < 0)
-		split_field0();
-	    if (t <= nf)
+	    if (nf < 0 ? split_field0_to(t) : t <= nf)
 		cellcpy(sp, field_ptr(t));
 	    else {
 		sp->type = C_STRING;
@@ -1041,15 +1037,43 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    sp->dval = t >= 0 ? 1.0 : 0.0;
 	    break;
 
+	case _MATCH0S:
+	    /* does $0 match the RE of the pattern at cdp, see re_rules() */
+	    if (field->type >= C_STRING) {
+		RE_RULE *rule = (RE_RULE *) cdp->ptr;
+
+		t = re_rule_test((PTR) rule, string(field));
+		if (!t && rule->fail != 0) {
+		    /* skip the _JZ, and the patterns after it which fail */
+		    cdp = re_rule_skip(rule);
+		    break;
+		}
+		cdp++;
+		inc_sp();
+		sp->type = C_DOUBLE;
+		sp->dval = t ? 1.0 : 0.0;
+	    } else {
+		inc_sp();
+		cellcpy(sp, field);
+		cast1_to_s(sp);
+		t = re_test(rule_to_re((cdp++)->ptr),
+			    string(sp)->str,
+			    string(sp)->len);
+		free_STRING(string(sp));
+		sp->type = C_DOUBLE;
+		sp->dval = t ? 1.0 : 0.0;
+	    }
+	    break;
+
 	case _MATCH0:
 	    /* does $0 match, the RE at cdp? */
 
 	    inc_sp();
 	    if (field->type >= C_STRING) {
 		sp->type = C_DOUBLE;
-		sp->dval = (REtest(string(field)->str,
-				   string(field)->len,
-				   cast_to_re((cdp++)->ptr))
+		sp->dval = (re_test((cdp++)->ptr,
+				    string(field)->str,
+				    string(field)->len)
 			    ? 1.0
 			    : 0.0);
 
@@ -1063,9 +1087,9 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    /* does expr at sp[0] match RE at cdp */
 	    if (sp->type < C_STRING)
 		cast1_to_s(sp);
-	    t = REtest(string(sp)->str,
-		       string(sp)->len,
-		       cast_to_re((cdp++)->ptr));
+	    t = re_test((cdp++)->ptr,
+			string(sp)->str,
+			string(sp)->len);
 	    free_STRING(string(sp));
 	    sp->type = C_DOUBLE;
 	    sp->dval = t ? 1.0 : 0.0;
@@ -1077,9 +1101,9 @@ execute(INST * cdp,		/* code ptr, start execution here */
 
 	    if ((--sp)->type < C_STRING)
 		cast1_to_s(sp);
-	    t = REtest(string(sp)->str,
-		       string(sp)->len,
-		       cast_to_re((sp + 1)->ptr));
+	    t = re_test((sp + 1)->ptr,
+			string(sp)->str,
+			string(sp)->len);
 
 	    free_STRING(string(sp));
 	    no_leaks_re_ptr((sp + 1)->ptr);
@@ -1157,8 +1181,14 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    break;
 
 	case _OMAIN:
-	    if (!main_fin)
-		open_main();
+	    if (!main_fin) {
+#if USE_PARALLEL
+		if (parallel_jobs > 1)
+		    parallel_main();
+		else
+#endif
+		    open_main();
+	    }
 	    restart_label = cdp;
 	    cdp = next_label;
 	    break;
@@ -1182,6 +1212,10 @@ execute(INST * cdp,		/* code ptr, start execution here */
 		size_t len;
 
 		if (!(p = FINgets(main_fin, &len))) {
+#if USE_PARALLEL
+		    if (parallel_worker)
+			parallel_finish();
+#endif
 		    if (force_exit)
 			mawk_exit(0);
 
@@ -1191,6 +1225,8 @@ execute(INST * cdp,		/* code ptr, start execution here */
 		    force_exit = 1;
 		} else {
 		    set_field0(p, len);
+		    if (main_fin->flags & MMAP_FLAG)
+			passthru_record(p, main_fin->buff + main_fin->mapped);
 		    cdp = restart_label;
 		    rt_nr++;
 		    rt_fnr++;
@@ -1206,6 +1242,10 @@ execute(INST * cdp,		/* code ptr, start execution here */
 		size_t len;
 
 		if (!(p = FINgets(main_fin, &len))) {
+#if USE_PARALLEL
+		    if (parallel_worker)
+			parallel_finish();
+#endif
 		    if (force_exit)
 			mawk_exit(0);
 
@@ -1215,6 +1255,8 @@ execute(INST * cdp,		/* code ptr, start execution here */
 		    force_exit = 1;
 		} else {
 		    set_field0(p, len);
+		    if (main_fin->flags & MMAP_FLAG)
+			passthru_record(p, main_fin->buff + main_fin->mapped);
 		    cdp = restart_label;
 
 		    if (TEST2(NR) != TWO_DOUBLES)
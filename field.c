@@ -79,8 +79,18 @@ CELL *fbank[NUM_FBANK] =
 
 static int max_field = MAX_SPLIT;	/* maximum field actually created */
 
+/*
+ * While nf < 0, the first split_count fields of $0 may have been split
+ * already, and the rest of it begins split_rest bytes in.  A program which
+ * reads only $1 ... $n, for constants up to max_field_read, splits no more
+ * of a record than that, unless it uses NF or a $i beyond those.
+ */
+int max_field_read;		/* see field_A2I() */
+static int split_count;
+static size_t split_rest;
+
 static void build_field0(void);
-static void load_field_ov(void);
+static void load_fields(int, size_t);
 
 /* a description of how to split based on RS.
    If RS is changed, so is rs_shadow */
@@ -116,17 +126,18 @@ set_rs_shadow(void)
     cast_for_split(cellcpy(&c, RS));
     switch (c.type) {
     case C_RE:
-	if ((s = is_string_split(c.ptr, &len))) {
+	if ((s = is_string_split(cast_to_re(c.ptr), &len))) {
 	    if (len == 1) {
 		rs_shadow.type = SEP_CHAR;
 		rs_shadow.c = s[0];
 	    } else {
 		rs_shadow.type = SEP_STR;
-		rs_shadow.ptr = (PTR) new_STRING(s);
+		rs_shadow.ptr = (PTR) new_STRING1(s, (size_t) len);
 	    }
 	} else {
 	    rs_shadow.type = SEP_RE;
 	    rs_shadow.ptr = c.ptr;
+	    re_pin(c.ptr);
 	}
 	break;
 
@@ -141,6 +152,7 @@ set_rs_shadow(void)
 	rs_shadow.type = SEP_MLR;
 	sval = new_STRING("\n\n+");
 	rs_shadow.ptr = re_compile(sval);
+	re_pin(rs_shadow.ptr);
 	free_STRING(sval);
 	break;
 
@@ -207,6 +219,8 @@ set_field0(char *s, size_t len)
 {
     cell_destroy(&field[0]);
     nf = -1;
+    split_count = 0;
+    split_rest = 0;
 
     if (len) {
 	field[0].type = C_MBSTRN;
@@ -219,13 +233,23 @@ set_field0(char *s, size_t len)
     }
 }
 
-/* split field[0] into $1, $2 ... and set NF  */
+static void
+set_nf(void)
+{
+    cell_destroy(NF);
+    NF->type = C_DOUBLE;
+    NF->dval = (double) nf;
+}
+
+/* split field[0], or what is left of it, into $1, $2 ... and set NF  */
 
 void
 split_field0(void)
 {
     register CELL *cp;
-    register int cnt;
+    size_t cnt;
+    size_t len;
+    char *s;
     CELL c;			/* copy field[0] here if not string */
 
     if (field[0].type < C_STRING) {
@@ -234,45 +258,78 @@ split_field0(void)
     } else
 	cp = &field[0];
 
+    s = string(cp)->str + split_rest;
+    len = string(cp)->len - split_rest;
+
     if (string(cp)->len == 0)
-	nf = 0;
+	cnt = 0;
     else {
 	switch (fs_shadow.type) {
 	case C_SNULL:		/* FS == "" */
-	    nf = (int) null_split(string(cp)->str, string(cp)->len);
+	    cnt = null_split(s, len);
 	    break;
 
 	case C_SPACE:
-	    nf = (int) space_split(string(cp)->str, string(cp)->len);
+	    cnt = space_split(s, len);
 	    break;
 
 	default:
-	    nf = (int) re_split(string(cp), fs_shadow.ptr);
+	    cnt = re_split(s, len, fs_shadow.ptr);
 	    break;
 	}
 
     }
 
-    cell_destroy(NF);
-    NF->type = C_DOUBLE;
-    NF->dval = (double) nf;
+    load_fields(split_count, cnt);
+    nf = split_count + (int) cnt;
+    split_count = 0;
+    split_rest = 0;
+    set_nf();
 
-    if (nf > MAX_SPLIT) {
-	cnt = MAX_SPLIT;
-	load_field_ov();
-    } else
-	cnt = nf;
+    if (cp == &c) {
+	free_STRING(string(cp));
+    }
+}
+
+/*
+ * Split $0, while nf < 0, far enough to read $i, and return nonzero if
+ * there is a $i.  Unless that takes all of it, stop after $i, or after
+ * the highest constant field which the program reads, if that is more.
+ */
+int
+split_field0_to(int i)
+{
+    STRING *sval;
+    char *rest;
+    int most;
+    size_t cnt;
 
-    while (cnt > 0) {
-	cell_destroy(field + cnt);
-	field[cnt].ptr = (PTR) split_buff[cnt - 1];
-	USED_SPLIT_BUFF(cnt - 1);
-	field[cnt--].type = C_MBSTRN;
+    if (i <= split_count)
+	return 1;
+
+    most = (i > max_field_read) ? i : max_field_read;
+    if (most >= MAX_SPLIT
+	|| field[0].type < C_STRING
+	|| string(field)->len == 0) {
+	split_field0();
+	return i <= nf;
     }
 
-    if (cp == &c) {
-	free_STRING(string(cp));
+    sval = string(field);
+    cnt = split_front(sval->str + split_rest, sval->len - split_rest,
+		      (size_t) (most - split_count), &rest);
+    load_fields(split_count, cnt);
+    split_count += (int) cnt;
+
+    if (rest == 0) {
+	nf = split_count;
+	split_count = 0;
+	split_rest = 0;
+	set_nf();
+	return i <= nf;
     }
+    split_rest = (size_t) (rest - sval->str);
+    return 1;
 }
 
 /*
@@ -291,6 +348,8 @@ field_assign(CELL * fp, CELL * cp)
 	cell_destroy(field);
 	cellcpy(fp, cp);
 	nf = -1;
+	split_count = 0;
+	split_rest = 0;
 	return;
     }
 
@@ -340,6 +399,8 @@ field_assign(CELL * fp, CELL * cp)
     case FS_field:
 	cell_destroy(FS);
 	cast_for_split(cellcpy(&fs_shadow, cellcpy(FS, cp)));
+	if (fs_shadow.type == C_RE)
+	    re_pin(fs_shadow.ptr);
 	break;
 
     case OFMT_field:
@@ -588,41 +649,38 @@ slow_field_ptr(int i)
 }
 
 /*
-  $0 split into more than MAX_SPLIT fields,
-  $(MAX_FIELD+1) ... are on the split_ov_list.
-  Copy into fields which start at fbank[1]
+  Load the cnt pieces of a split into $(first+1), $(first+2) ...
+  The first MAX_SPLIT are in split_buff[], the rest on the
+  split_ov_list.
 */
 
 static void
-load_field_ov(void)
+load_fields(int first, size_t cnt)
 {
     register SPLIT_OV *p;	/* walks split_ov_list */
     register CELL *cp;		/* target of copy */
-    int j;			/* current fbank[] */
-    CELL *cp_limit;		/* change fbank[] */
     SPLIT_OV *q;		/* trails p */
+    size_t n;
 
     /* make sure the fields are allocated */
-    slow_field_ptr(nf);
+    if (first + (int) cnt > MAX_SPLIT)
+	slow_field_ptr(first + (int) cnt);
 
     p = split_ov_list;
     split_ov_list = (SPLIT_OV *) 0;
-    j = 1;
-    cp = fbank[j];
-    cp_limit = cp + FBANK_SZ;
-    while (p) {
+    for (n = 0; n < cnt; ++n) {
+	cp = field_ptr(first + (int) n + 1);
 	cell_destroy(cp);
 	cp->type = C_MBSTRN;
-	cp->ptr = (PTR) p->sval;
-
-	if (++cp == cp_limit) {
-	    cp = fbank[++j];
-	    cp_limit = cp + FBANK_SZ;
+	if (n < MAX_SPLIT) {
+	    cp->ptr = (PTR) split_buff[n];
+	    USED_SPLIT_BUFF(n);
+	} else {
+	    cp->ptr = (PTR) p->sval;
+	    q = p;
+	    p = p->link;
+	    ZFREE(q);
 	}
-
-	q = p;
-	p = p->link;
-	ZFREE(q);
     }
 }
 
@@ -677,8 +735,8 @@ field_leaks(void)
     free_STRING(string(RS));
     cell_destroy(&field[0]);
 
-    for (n = 1; n <= nf; ++n) {
-	cell_destroy(&field[n]);
+    for (n = 1; n <= ((nf < 0) ? split_count : nf); ++n) {
+	cell_destroy(field_ptr(n));
     }
 
     switch (fs_shadow.type) {
@@ -38,7 +38,9 @@ the GNU General Public License, version 2, 1991.
 extern void set_field0(char *, size_t);
 extern void split_field0(void);
 extern size_t space_split(char *, size_t);
-extern size_t re_split(STRING *, PTR);
+extern size_t re_split(char *, size_t, PTR);
+extern size_t split_front(char *, size_t, size_t, char **);
+extern int split_field0_to(int);
 extern size_t null_split(char *, size_t);
 extern void field_assign(CELL *, CELL *);
 extern char *is_string_split(PTR, unsigned *);
@@ -83,6 +85,7 @@ extern CELL *fbank[NUM_FBANK];	/* fbank[0] == field */
 #define  LAST_PFIELD	OFMT
 
 extern int nf;			/* shadows NF */
+extern int max_field_read;	/* the highest constant $n read */
 
 /* a shadow type for RS and FS */
 #define  SEP_SPACE      0
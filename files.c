@@ -246,6 +246,7 @@ file_close(STRING * sval)
     char *name = sval->str;
     int retval = -1;
 
+    passthru_flush();
     dummy.link = p = file_list;
     while (p) {
 	if (strcmp(name, p->name->str) == 0) {
@@ -359,6 +360,8 @@ flush_all_output(void)
 static void
 efflush(FILE *fp)
 {
+    if (fp == stdout)
+	passthru_flush();
     if (fflush(fp) < 0) {
 	errmsg(errno, "unexpected write error");
 	mawk_exit(2);
@@ -381,6 +384,7 @@ close_out_pipes(void)
     FILE_NODE *p = file_list;
     FILE_NODE *q = 0;
 
+    passthru_flush();
     while (p) {
 
 	if (IS_OUTPUT(p->type)) {
@@ -450,6 +454,7 @@ get_pipe(char *name, int type, int *pid_ptr)
     local_fd = the_pipe[type == PIPE_OUT];
     remote_fd = the_pipe[type == PIPE_IN];
     /* to keep output ordered correctly */
+    passthru_flush();
     fflush(stdout);
     fflush(stderr);
 
@@ -55,6 +55,17 @@ extern PTR get_pipe(char *, int, int *);
 extern int wait_for(int);
 extern void close_out_pipes(void);
 
+/* print of an unchanged $0 read from a mapped file writes the mapping */
+#if defined(HAVE_MMAP) && defined(HAVE_WRITEV) && defined(HAVE_SYS_UIO_H)
+#define USE_PASSTHRU 1
+#else
+#define USE_PASSTHRU 0
+#endif
+
+extern void passthru_record(char *, char *);
+extern void passthru_flush(void);
+extern void passthru_unmap(char *, size_t);
+
 #ifdef  HAVE_FAKE_PIPES
 extern void close_fake_pipes(void);
 extern int close_fake_outpipe(char *, int);
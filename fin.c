@@ -73,6 +73,7 @@ the GNU General Public License, version 2, 1991.
 
 #include "mawk.h"
 #include "fin.h"
+#include "files.h"
 #include "memory.h"
 #include "bi_vars.h"
 #include "field.h"
@@ -83,26 +84,925 @@ the GNU General Public License, version 2, 1991.
 #include <fcntl.h>
 #endif
 
+#if defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H) \
+ && defined(HAVE_SIGACTION_SA_SIGACTION)
+#define USE_MMAP 1
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <signal.h>
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+#else
+#define USE_MMAP 0
+#endif
+
+#if defined(HAVE_PTHREAD_H) && defined(HAVE_LIBPTHREAD)
+#define USE_READAHEAD 1
+#include <pthread.h>
+#else
+#define USE_READAHEAD 0
+#endif
+
+#if defined(HAVE_ZLIB_H) && defined(HAVE_LIBZ)
+#define USE_ZLIB 1
+#include <zlib.h>
+#else
+#define USE_ZLIB 0
+#endif
+
+#if defined(HAVE_ZSTD_H) && defined(HAVE_LIBZSTD)
+#define USE_ZSTD 1
+#include <zstd.h>
+#else
+#define USE_ZSTD 0
+#endif
+
+#if USE_ZLIB || USE_ZSTD
+#define USE_UNZIP 1
+#include <sys/types.h>
+#include <sys/stat.h>
+#else
+#define USE_UNZIP 0
+#endif
+
+#if defined(__GNUC__) && (__GNUC__ >= 5 || defined(__clang__)) \
+ && (defined(__x86_64__) || defined(__i386__))
+#define USE_RS_INDEX 1
+#include <immintrin.h>
+#else
+#define USE_RS_INDEX 0
+#endif
+
+#if defined(HAVE_POSIX_FADVISE)
+#define USE_PREFETCH 1
+#include <sys/types.h>
+#include <sys/stat.h>
+#else
+#define USE_PREFETCH 0
+#endif
+
 /* This file handles input files.  Opening, closing,
    buffering and (most important) splitting files into
    records, FINgets().
 */
 
+/* starting size of input buffers, which double as needed */
+size_t fin_chunk = BUFFSZ;
+
+/* number of main input files to open ahead of time */
+int fin_prefetch = 1;
+
+/* decompress gzip and zstd input, unless -W decompress=0 */
+int fin_decompress = 1;
+
+/* map regular files rather than reading them, unless -W mmap=0 */
+int fin_mmap = 1;
+
+#define FinBuffSize(fin) ((size_t) (fin)->nbuffs * fin_chunk)
+
 static FIN *next_main(int);
 static char *enlarge_fin_buffer(FIN *);
+static size_t fin_fill(FIN *, char *, size_t);
 int is_cmdline_assign(char *);	/* also used by init */
 
 /* this is how we mark EOF on main_fin  */
 static char dead_buff = 0;
 static FIN dead_main =
 {0, (FILE *) 0, &dead_buff, &dead_buff, &dead_buff,
- 1, EOF_FLAG};
+ 1, EOF_FLAG, 0, 0, 0, 0, 0};
+
+#if USE_MMAP
+static size_t page_size;
+
+/* a mapping always extends at least one byte past the file's data */
+#define map_length(size) ((((size) / page_size) + 1) * page_size)
+
+/*
+ * A mapped file may be truncated while it is read, e.g., by logrotate's
+ * copytruncate.  Touching a page past its new end then raises SIGBUS.
+ * The handler maps zero-filled pages over the rest of the mapping, so the
+ * access which faulted completes, and notes that the file shrank; FINgets
+ * then takes the file's new size as its end.
+ */
+struct fin_map {
+    struct fin_map *link;
+    char *base;
+    size_t length;		/* of the mapping */
+    size_t size;		/* of the file's data in it */
+    volatile sig_atomic_t shrunk;
+};
+
+static struct fin_map *map_list;
+
+static void
+map_fault(int sig, siginfo_t * info, void *context GCC_UNUSED)
+{
+#ifdef MAP_ANONYMOUS
+    struct fin_map *p;
+    char *addr = (char *) info->si_addr;
+
+    for (p = map_list; p != 0; p = p->link) {
+	if (addr >= p->base && addr < p->base + p->length) {
+	    char *page = p->base + ((size_t) (addr - p->base)
+				    / page_size) * page_size;
+
+	    if (mmap(page, (size_t) (p->base + p->length - page), PROT_READ,
+		     MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED,
+		     -1, (off_t) 0) != MAP_FAILED) {
+		p->shrunk = 1;
+		return;
+	    }
+	    break;
+	}
+    }
+#endif
+    /* not one of ours:  fault again, and die as usual */
+    signal(sig, SIG_DFL);
+}
+
+static void
+add_fin_map(FIN * fin, char *base, size_t size)
+{
+    static int trapped;
+    struct fin_map *p = ZMALLOC(struct fin_map);
+
+    if (!trapped) {
+	struct sigaction x;
+
+	memset(&x, 0, sizeof(x));
+	x.sa_sigaction = map_fault;
+	x.sa_flags = SA_SIGINFO;
+	sigaction(SIGBUS, &x, (struct sigaction *) 0);
+	trapped = 1;
+    }
+    p->base = base;
+    p->length = map_length(size);
+    p->size = size;
+    p->shrunk = 0;
+    p->link = map_list;
+    map_list = p;
+    fin->map = p;
+}
+
+static void
+unmap_fin_data(FIN * fin)
+{
+    struct fin_map **pp;
+
+    passthru_unmap(fin->buff, fin->mapped);
+    munmap(fin->buff, map_length(fin->mapped));
+    for (pp = &map_list; *pp != 0; pp = &(*pp)->link) {
+	if (*pp == fin->map) {
+	    *pp = fin->map->link;
+	    break;
+	}
+    }
+    ZFREE(fin->map);
+    fin->map = 0;
+    fin->flags &= ~MMAP_FLAG;
+}
+
+/* the file was truncated:  its data ends at its new size */
+static void
+map_shrunk(FIN * fin)
+{
+    struct stat sb;
+    size_t size = 0;
+
+    fin->map->shrunk = 0;
+    if (fstat(fin->fd, &sb) == 0 && sb.st_size > 0)
+	size = (size_t) sb.st_size;
+    TRACE(("mapped fd %d shrank to %lu bytes\n", fin->fd, (unsigned long) size));
+    if (fin->map->size > size)
+	fin->map->size = size;
+    if ((size_t) (fin->limit - fin->buff) > size)
+	fin->limit = fin->buff + size;
+    if (fin->buffp > fin->limit)
+	fin->buffp = fin->limit;
+}
+
+/*
+ * At the end of a mapped file, look at its size again.  If it has grown,
+ * read the rest of it as if it had not been mapped, after what is left of
+ * the current record.
+ */
+static int
+map_grown(FIN * fin)
+{
+    struct stat sb;
+    size_t done = fin->map->size;
+    size_t tail = (size_t) (fin->limit - fin->buffp);
+    size_t want;
+    size_t r;
+    char *buff;
+
+    if (fstat(fin->fd, &sb) != 0
+	|| sb.st_size <= (off_t) done
+	|| lseek(fin->fd, (off_t) done, SEEK_SET) != (off_t) done)
+	return 0;
+
+    TRACE(("mapped fd %d grew to %lu bytes\n", fin->fd,
+	   (unsigned long) sb.st_size));
+    fin->nbuffs = 1;
+    while (FinBuffSize(fin) < 2 * tail)
+	fin->nbuffs *= 2;
+    buff = (char *) zmalloc(FinBuffSize(fin) + 1);
+    memcpy(buff, fin->buffp, tail);
+    unmap_fin_data(fin);
+
+    fin->buffp = fin->buff = buff;
+    fin->limit = buff + tail;
+    fin->flags &= ~EOF_FLAG;
+    want = FinBuffSize(fin) - tail;
+    if ((r = fin_fill(fin, fin->limit, want)) < want)
+	fin->flags |= EOF_FLAG;
+    fin->limit += r;
+    return 1;
+}
+
+/*
+ * Map a regular file rather than reading it, so records are found in place:
+ * there are no read() calls, partial records are not moved to the front of
+ * the buffer, and long records do not grow the buffer.  Record splitting
+ * relies on a null following the data.  The kernel zero-fills the last page
+ * past the end of the file; if the file ends on a page boundary, an
+ * anonymous page is mapped after it instead.
+ *
+ * Only files read from their beginning are mapped; anything else (or any
+ * failure here) falls back to block buffering.
+ */
+static void
+map_fin_data(FIN * fin)
+{
+    struct stat sb;
+    size_t size;
+    char *base;
+
+    if (!fin_mmap
+	|| fstat(fin->fd, &sb) != 0
+	|| !S_ISREG(sb.st_mode)
+	|| sb.st_size <= 0
+	|| (off_t) (size_t) sb.st_size != sb.st_size
+	|| lseek(fin->fd, (off_t) 0, SEEK_CUR) != 0) {
+	return;
+    }
+
+    if (page_size == 0)
+	page_size = (size_t) sysconf(_SC_PAGESIZE);
+
+    size = (size_t) sb.st_size;
+    if (map_length(size) < size)
+	return;
+
+    if (size % page_size == 0) {
+#ifdef MAP_ANONYMOUS
+	base = (char *) mmap((void *) 0, map_length(size), PROT_READ,
+			     MAP_PRIVATE | MAP_ANONYMOUS, -1, (off_t) 0);
+	if (base == (char *) MAP_FAILED)
+	    return;
+	if (mmap(base, size, PROT_READ,
+		 MAP_PRIVATE | MAP_FIXED, fin->fd, (off_t) 0) == MAP_FAILED) {
+	    munmap(base, map_length(size));
+	    return;
+	}
+#else
+	return;
+#endif
+    } else {
+	base = (char *) mmap((void *) 0, size, PROT_READ,
+			     MAP_PRIVATE, fin->fd, (off_t) 0);
+	if (base == (char *) MAP_FAILED)
+	    return;
+    }
+#ifdef MADV_SEQUENTIAL
+    madvise(base, size, MADV_SEQUENTIAL);
+#endif
+
+    TRACE(("mapped %lu bytes from fd %d\n", (unsigned long) size, fin->fd));
+    zfree(fin->buff, FinBuffSize(fin) + 1);
+    fin->limit = fin->buffp = fin->buff = base;
+    fin->mapped = size;
+    fin->flags |= MMAP_FLAG;
+    add_fin_map(fin, base, size);
+}
+#endif /* USE_MMAP */
+
+#if USE_UNZIP
+/*
+ * Compressed regular files (gzip or zstd, recognized by their magic number)
+ * are decompressed as they are read, below FINgets, so record splitting
+ * sees only the uncompressed data.  This saves the extra process and the
+ * copy through a pipe of "zcat | mawk".  Other input, which cannot be
+ * looked at without reading it, is taken as it is.
+ */
+#define UNZIP_SZ	(16 * BUFFSZ)	/* compressed bytes read at a time */
+
+typedef enum {
+    Z_PLAIN = 0,
+    Z_GZIP,
+    Z_ZSTD
+} Z_KIND;
+
+struct unzip {
+    Z_KIND kind;
+    int fd;
+    int eof;			/* no more compressed input */
+    int ended;			/* at the end of a gzip member or zstd frame */
+    int full;			/* last call filled the target */
+    const char *message;	/* why decompressing failed */
+    char *in;			/* compressed input */
+#if USE_ZLIB
+    z_stream zs;
+#endif
+#if USE_ZSTD
+    ZSTD_DStream *zds;
+    ZSTD_inBuffer zin;
+#endif
+};
+
+static Z_KIND
+unzip_kind(int fd)
+{
+    Z_KIND result = Z_PLAIN;
+    struct stat sb;
+    unsigned char magic[4];
+
+    if (fin_decompress && fstat(fd, &sb) == 0 && S_ISREG(sb.st_mode)) {
+	/* look without reading, which would lose the data for plain files */
+	off_t here = lseek(fd, (off_t) 0, SEEK_CUR);
+
+	if (here >= 0
+	    && pread(fd, magic, sizeof(magic), here) == (ssize_t) sizeof(magic)) {
+#if USE_ZLIB
+	    if (magic[0] == 0x1f && magic[1] == 0x8b)
+		result = Z_GZIP;
+#endif
+#if USE_ZSTD
+	    if (magic[0] == 0x28 && magic[1] == 0xb5
+		&& magic[2] == 0x2f && magic[3] == 0xfd)
+		result = Z_ZSTD;
+#endif
+	}
+    }
+    return result;
+}
+
+static void
+start_unzip(FIN * fin, Z_KIND kind)
+{
+    struct unzip *uz = ZMALLOC(struct unzip);
+
+    memset(uz, 0, sizeof(*uz));
+    uz->kind = kind;
+    uz->fd = fin->fd;
+    uz->in = (char *) zmalloc((size_t) UNZIP_SZ);
+
+    switch (kind) {
+#if USE_ZLIB
+    case Z_GZIP:
+	/* 16 + MAX_WBITS accepts only the gzip format */
+	if (inflateInit2(&uz->zs, 16 + MAX_WBITS) != Z_OK) {
+	    errmsg(0, "cannot initialize gzip decompression");
+	    mawk_exit(2);
+	}
+	break;
+#endif
+#if USE_ZSTD
+    case Z_ZSTD:
+	if ((uz->zds = ZSTD_createDStream()) == 0) {
+	    errmsg(0, "cannot initialize zstd decompression");
+	    mawk_exit(2);
+	}
+	ZSTD_initDStream(uz->zds);
+	break;
+#endif
+    default:
+	bozo("unzip kind");
+    }
+    TRACE(("decompressing fd %d\n", fin->fd));
+    fin->unzip = uz;
+}
+
+static void
+stop_unzip(FIN * fin)
+{
+    struct unzip *uz = fin->unzip;
+
+#if USE_ZLIB
+    if (uz->kind == Z_GZIP)
+	inflateEnd(&uz->zs);
+#endif
+#if USE_ZSTD
+    if (uz->kind == Z_ZSTD)
+	ZSTD_freeDStream(uz->zds);
+#endif
+    zfree(uz->in, (size_t) UNZIP_SZ);
+    ZFREE(uz);
+    fin->unzip = 0;
+}
+
+static const char *
+unzip_name(struct unzip *uz)
+{
+    return (uz->kind == Z_GZIP) ? "gzip" : "zstd";
+}
+
+/* read more compressed input, returns -1 on error */
+static ssize_t
+unzip_input(struct unzip *uz)
+{
+    ssize_t r;
+
+    do {
+	r = read(uz->fd, uz->in, (size_t) UNZIP_SZ);
+    } while (r < 0 && errno == EINTR);
+    if (r == 0)
+	uz->eof = 1;
+    return r;
+}
+
+/*
+ * Like read(): returns the number of bytes decompressed into target, zero
+ * at the end of the data, or -1 with errno set.  If the data is corrupt,
+ * uz->message says why.  Concatenated gzip members or zstd frames are
+ * decompressed one after another, as zcat does.
+ */
+static ssize_t
+unzip_read(struct unzip *uz, char *target, size_t size)
+{
+    size_t got = 0;
+
+    while (got == 0) {
+	size_t avail = 0;
+
+#if USE_ZLIB
+	if (uz->kind == Z_GZIP)
+	    avail = uz->zs.avail_in;
+#endif
+#if USE_ZSTD
+	if (uz->kind == Z_ZSTD)
+	    avail = uz->zin.size - uz->zin.pos;
+#endif
+	/* the decompressor may hold more output than fit last time */
+	if (avail == 0 && (uz->ended || !uz->full)) {
+	    ssize_t r;
+
+	    if (uz->eof || (r = unzip_input(uz)) == 0) {
+		if (!uz->ended) {
+		    uz->message = "unexpected end of compressed data";
+		    errno = EIO;
+		    return -1;
+		}
+		break;
+	    } else if (r < 0) {
+		return -1;
+	    }
+	    avail = (size_t) r;
+#if USE_ZLIB
+	    if (uz->kind == Z_GZIP) {
+		uz->zs.next_in = (Bytef *) uz->in;
+		uz->zs.avail_in = (uInt) avail;
+	    }
+#endif
+#if USE_ZSTD
+	    if (uz->kind == Z_ZSTD) {
+		uz->zin.src = uz->in;
+		uz->zin.size = avail;
+		uz->zin.pos = 0;
+	    }
+#endif
+	}
+#if USE_ZLIB
+	if (uz->kind == Z_GZIP) {
+	    int rc;
+
+	    if (uz->ended) {
+		/* another member follows */
+		inflateReset(&uz->zs);
+		uz->ended = 0;
+	    }
+	    uz->zs.next_out = (Bytef *) target;
+	    uz->zs.avail_out = (uInt) size;
+	    rc = inflate(&uz->zs, Z_NO_FLUSH);
+	    got = size - uz->zs.avail_out;
+	    if (rc == Z_STREAM_END) {
+		uz->ended = 1;
+	    } else if (rc != Z_OK && rc != Z_BUF_ERROR) {
+		uz->message = uz->zs.msg ? uz->zs.msg : "corrupt gzip data";
+		errno = EIO;
+		return -1;
+	    }
+	}
+#endif
+#if USE_ZSTD
+	if (uz->kind == Z_ZSTD) {
+	    ZSTD_outBuffer out;
+	    size_t rc;
+
+	    out.dst = target;
+	    out.size = size;
+	    out.pos = 0;
+	    rc = ZSTD_decompressStream(uz->zds, &out, &uz->zin);
+	    if (ZSTD_isError(rc)) {
+		uz->message = ZSTD_getErrorName(rc);
+		errno = EIO;
+		return -1;
+	    }
+	    /* zero means a frame was completely decoded and flushed */
+	    uz->ended = (rc == 0);
+	    got = out.pos;
+	}
+#endif
+	uz->full = (got == size);
+    }
+    return (ssize_t) got;
+}
+
+/* same contract as fillbuff() */
+static size_t
+unzip_fill(struct unzip *uz, char *target, size_t size)
+{
+    size_t entry_size = size;
+    ssize_t r;
+
+    while (size) {
+	if ((r = unzip_read(uz, target, size)) < 0) {
+	    if (uz->message) {
+		errmsg(0, "%s: %s", unzip_name(uz), uz->message);
+	    } else {
+		errmsg(errno, "read error");
+	    }
+	    mawk_exit(2);
+	} else if (r == 0) {
+	    break;
+	}
+	target += r;
+	size -= (size_t) r;
+    }
+    *target = 0;
+    return (size_t) (entry_size - size);
+}
+#endif /* USE_UNZIP */
+
+#if USE_READAHEAD
+/*
+ * With -W readahead, a reader thread fills one block while FINgets works
+ * through the records copied from the other, so that execution overlaps
+ * with waiting on read().  Each block is owned by the reader until it is
+ * marked full, and by FINgets until it has been emptied.  A full block of
+ * length zero marks end-of-file.
+ */
+#define READ_AHEAD_SZ	(16 * BUFFSZ)
+
+struct read_ahead {
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int fd;
+    struct unzip *unzip;	/* decompress what is read, if set */
+    int stop;			/* set when the FIN is closed */
+    int error;			/* errno from a failed read */
+    int next;			/* block FINgets copies from */
+    size_t used;		/* ...and how much of it was copied */
+    char *block[2];
+    size_t length[2];
+    int full[2];
+};
+
+static void *
+read_ahead_thread(void *arg)
+{
+    struct read_ahead *ra = (struct read_ahead *) arg;
+    int k = 0;
+    ssize_t r;
+
+    pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, (int *) 0);
+    for (;;) {
+	pthread_mutex_lock(&ra->lock);
+	while (ra->full[k] && !ra->stop)
+	    pthread_cond_wait(&ra->cond, &ra->lock);
+	if (ra->stop) {
+	    pthread_mutex_unlock(&ra->lock);
+	    break;
+	}
+	pthread_mutex_unlock(&ra->lock);
+
+	/* the only place the thread may be cancelled */
+	pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, (int *) 0);
+#if USE_UNZIP
+	if (ra->unzip) {
+	    r = unzip_read(ra->unzip, ra->block[k], (size_t) READ_AHEAD_SZ);
+	} else
+#endif
+	    do {
+		r = read(ra->fd, ra->block[k], (size_t) READ_AHEAD_SZ);
+	    } while (r < 0 && errno == EINTR);
+	pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, (int *) 0);
+
+	pthread_mutex_lock(&ra->lock);
+	if (r < 0) {
+	    ra->error = errno;
+	    r = 0;
+	}
+	ra->length[k] = (size_t) r;
+	ra->full[k] = 1;
+	pthread_cond_broadcast(&ra->cond);
+	pthread_mutex_unlock(&ra->lock);
+
+	if (r == 0)
+	    break;
+	k = !k;
+    }
+    return (void *) 0;
+}
+
+/* same contract as fillbuff(), but copies from the reader's blocks */
+static size_t
+read_ahead_fill(struct read_ahead *ra, char *target, size_t size)
+{
+    size_t entry_size = size;
+    int k;
+
+    while (size) {
+	size_t n;
+
+	k = ra->next;
+	pthread_mutex_lock(&ra->lock);
+	while (!ra->full[k])
+	    pthread_cond_wait(&ra->cond, &ra->lock);
+	pthread_mutex_unlock(&ra->lock);
+
+	if (ra->length[k] == 0) {
+	    if (ra->error) {
+#if USE_UNZIP
+		if (ra->unzip && ra->unzip->message) {
+		    errmsg(0, "%s: %s",
+			   unzip_name(ra->unzip), ra->unzip->message);
+		    mawk_exit(2);
+		}
+#endif
+		errmsg(ra->error, "read error");
+		mawk_exit(2);
+	    }
+	    break;		/* leave the block full: EOF again next time */
+	}
+
+	n = ra->length[k] - ra->used;
+	if (n > size)
+	    n = size;
+	memcpy(target, ra->block[k] + ra->used, n);
+	target += n;
+	size -= n;
+
+	if ((ra->used += n) == ra->length[k]) {
+	    ra->used = 0;
+	    ra->next = !k;
+	    pthread_mutex_lock(&ra->lock);
+	    ra->full[k] = 0;
+	    pthread_cond_broadcast(&ra->cond);
+	    pthread_mutex_unlock(&ra->lock);
+	}
+    }
+
+    *target = 0;
+    return (size_t) (entry_size - size);
+}
+
+static void
+start_read_ahead(FIN * fin)
+{
+    struct read_ahead *ra = ZMALLOC(struct read_ahead);
+
+    memset(ra, 0, sizeof(*ra));
+    ra->fd = fin->fd;
+#if USE_UNZIP
+    ra->unzip = fin->unzip;
+#endif
+    ra->block[0] = (char *) zmalloc((size_t) READ_AHEAD_SZ);
+    ra->block[1] = (char *) zmalloc((size_t) READ_AHEAD_SZ);
+    pthread_mutex_init(&ra->lock, (pthread_mutexattr_t *) 0);
+    pthread_cond_init(&ra->cond, (pthread_condattr_t *) 0);
+
+    if (pthread_create(&ra->thread, (pthread_attr_t *) 0,
+		       read_ahead_thread, ra) != 0) {
+	/* no thread, so read in this one */
+	pthread_cond_destroy(&ra->cond);
+	pthread_mutex_destroy(&ra->lock);
+	zfree(ra->block[0], (size_t) READ_AHEAD_SZ);
+	zfree(ra->block[1], (size_t) READ_AHEAD_SZ);
+	ZFREE(ra);
+	return;
+    }
+    TRACE(("started reader thread for fd %d\n", fin->fd));
+    fin->ahead = ra;
+}
+
+/* the reader may be blocked in read(), e.g., on a pipe */
+static void
+stop_read_ahead(FIN * fin)
+{
+    struct read_ahead *ra = fin->ahead;
+
+    pthread_mutex_lock(&ra->lock);
+    ra->stop = 1;
+    pthread_cond_broadcast(&ra->cond);
+    pthread_mutex_unlock(&ra->lock);
+    pthread_cancel(ra->thread);
+    pthread_join(ra->thread, (void **) 0);
+
+    pthread_cond_destroy(&ra->cond);
+    pthread_mutex_destroy(&ra->lock);
+    zfree(ra->block[0], (size_t) READ_AHEAD_SZ);
+    zfree(ra->block[1], (size_t) READ_AHEAD_SZ);
+    ZFREE(ra);
+    fin->ahead = 0;
+}
+#endif /* USE_READAHEAD */
+
+#if USE_RS_INDEX
+/*
+ * For RS of a fixed string, FINgets indexes the buffer ahead of the current
+ * record in one vectorized pass, making a bitmap of the places where the
+ * first two characters of the separator occur.  Each record is then found
+ * by taking the lowest bit from the bitmap (checking the rest of a longer
+ * separator), rather than by calling str_str() again, which stops at every
+ * occurrence of the first character.  The index is discarded whenever the
+ * buffer is refilled or RS changes.  It is used only if the CPU supports
+ * AVX2; otherwise FINgets searches as before.
+ *
+ * A single-character RS still uses memchr(), which the C library already
+ * vectorizes; indexing it did not run faster.
+ */
+#define RS_INDEX_SZ	4096	/* bytes indexed at one time */
+
+typedef unsigned long long RS_BITS;
+
+struct rs_index {
+    STRING *sval;		/* the separator (referenced) */
+    char *base;			/* indexed region is [base, end), if base */
+    char *end;
+    unsigned word;		/* map[word] is being used */
+    unsigned nwords;
+    RS_BITS bits;		/* what is left of map[word] */
+    RS_BITS map[RS_INDEX_SZ / 64];
+};
+
+static int
+rs_index_ok(void)
+{
+    static int result = -1;
+
+    if (result < 0) {
+	__builtin_cpu_init();
+	result = __builtin_cpu_supports("avx2") ? 1 : 0;
+	TRACE(("RS index %s\n", result ? "uses AVX2" : "is not used"));
+    }
+    return result;
+}
+
+/*
+ * Index [s, e), which is no longer than RS_INDEX_SZ.  This looks at the
+ * character at e, which is at most the null following the buffer's data.
+ */
+__attribute__((target("avx2")))
+static void
+avx2_index(struct rs_index *rx, char *s, char *e)
+{
+    char c0 = rx->sval->str[0];
+    char c1 = rx->sval->str[1];
+    __m256i want0 = _mm256_set1_epi8(c0);
+    __m256i want1 = _mm256_set1_epi8(c1);
+    unsigned n = 0;
+
+    rx->base = s;
+    rx->end = e;
+    while (e - s >= 64) {
+	const __m256i *lo = (const __m256i *) (void *) s;
+	const __m256i *hi = (const __m256i *) (void *) (s + 32);
+	const __m256i *lo1 = (const __m256i *) (void *) (s + 1);
+	const __m256i *hi1 = (const __m256i *) (void *) (s + 33);
+	unsigned m0 = (unsigned)
+	_mm256_movemask_epi8(_mm256_and_si256
+			     (_mm256_cmpeq_epi8(_mm256_loadu_si256(lo), want0),
+			      _mm256_cmpeq_epi8(_mm256_loadu_si256(lo1), want1)));
+	unsigned m1 = (unsigned)
+	_mm256_movemask_epi8(_mm256_and_si256
+			     (_mm256_cmpeq_epi8(_mm256_loadu_si256(hi), want0),
+			      _mm256_cmpeq_epi8(_mm256_loadu_si256(hi1), want1)));
+
+	rx->map[n++] = (RS_BITS) m0 | ((RS_BITS) m1 << 32);
+	s += 64;
+    }
+    if (s < e) {
+	RS_BITS m = 0;
+	unsigned k;
+
+	for (k = 0; s + k < e; ++k) {
+	    if (s[k] == c0 && s[k + 1] == c1)
+		m |= ((RS_BITS) 1) << k;
+	}
+	rx->map[n++] = m;
+    }
+    rx->nwords = n;
+    rx->word = 0;
+    rx->bits = rx->map[0];
+}
+
+static void
+free_rs_index(FIN * fin)
+{
+    if (fin->rsx->sval)
+	free_STRING(fin->rsx->sval);
+    ZFREE(fin->rsx);
+    fin->rsx = 0;
+}
+
+/* return the next separator in [p, fin->limit), like str_str() */
+static char *
+indexed_sep(FIN * fin, char *p)
+{
+    struct rs_index *rx = fin->rsx;
+    STRING *sval = (STRING *) rs_shadow.ptr;
+    size_t len = sval->len;
+
+    if (rx == 0) {
+	rx = fin->rsx = ZMALLOC(struct rs_index);
+	rx->sval = 0;
+	rx->base = 0;
+    }
+
+    if (rx->base == 0 || rx->sval != sval) {
+	if (rx->sval != sval) {
+	    if (rx->sval)
+		free_STRING(rx->sval);
+	    rx->sval = sval;
+	    sval->ref_cnt++;
+	}
+	rx->base = rx->end = p;
+	rx->word = rx->nwords = 0;
+	rx->bits = 0;
+    }
+
+    for (;;) {
+	while (rx->bits != 0) {
+	    char *q = rx->base + 64 * rx->word + __builtin_ctzll(rx->bits);
+
+	    rx->bits &= rx->bits - 1;
+	    /* a mapped file may be truncated after it was indexed */
+	    if (q >= p
+		&& (size_t) (fin->limit - q) >= len
+		&& ((len == 2 && !(fin->flags & MMAP_FLAG))
+		    || !memcmp(q, sval->str, len))) {
+		return q;
+	    }
+	}
+	if (rx->word + 1 < rx->nwords) {
+	    rx->bits = rx->map[++rx->word];
+	} else {
+	    char *s = (rx->end < p) ? p : rx->end;
+
+	    if (s >= fin->limit)
+		return (char *) 0;
+	    avx2_index(rx, s,
+		       ((size_t) (fin->limit - s) > RS_INDEX_SZ)
+		       ? s + RS_INDEX_SZ
+		       : fin->limit);
+	}
+    }
+}
+#endif /* USE_RS_INDEX */
+
+static void
+free_fin_buffer(FIN * fin)
+{
+#if USE_RS_INDEX
+    if (fin->rsx)
+	free_rs_index(fin);
+#endif
+#if USE_READAHEAD
+    if (fin->ahead)
+	stop_read_ahead(fin);
+#endif
+#if USE_UNZIP
+    if (fin->unzip)
+	stop_unzip(fin);
+#endif
+#if USE_MMAP
+    if (fin->flags & MMAP_FLAG) {
+	unmap_fin_data(fin);
+	return;
+    }
+#endif
+    zfree(fin->buff, FinBuffSize(fin) + 1);
+}
 
 static void
 free_fin_data(FIN * fin)
 {
     if (fin != &dead_main) {
-	zfree(fin->buff, (size_t) (fin->nbuffs * BUFFSZ + 1));
+	free_fin_buffer(fin);
 	ZFREE(fin);
     }
 }
@@ -114,14 +1014,32 @@ FIN *
 FINdopen(int fd, int main_flag)
 {
     FIN *fin = ZMALLOC(FIN);
+#if USE_UNZIP
+    Z_KIND kind = unzip_kind(fd);
+#endif
 
     fin->fd = fd;
     fin->flags = main_flag ? (MAIN_FLAG | START_FLAG) : START_FLAG;
-    fin->buffp = fin->buff = (char *) zmalloc((size_t) BUFFSZ + 1);
+    fin->buffp = fin->buff = (char *) zmalloc(fin_chunk + 1);
     fin->limit = fin->buffp;
     fin->nbuffs = 1;
     fin->buff[0] = 0;
-
+    fin->mapped = 0;
+    fin->ahead = 0;
+    fin->rsx = 0;
+    fin->unzip = 0;
+    fin->map = 0;
+
+#if USE_UNZIP
+    if (kind != Z_PLAIN) {
+	fin->fp = (FILE *) 0;
+	start_unzip(fin, kind);
+#if USE_READAHEAD
+	if (readahead_flag)
+	    start_read_ahead(fin);
+#endif
+    } else
+#endif
     if ((isatty(fd) && rs_shadow.type == SEP_CHAR && rs_shadow.c == '\n')
 	|| interactive_flag) {
 	/* interactive, i.e., line buffer this file */
@@ -134,6 +1052,14 @@ FINdopen(int fd, int main_flag)
 	}
     } else {
 	fin->fp = (FILE *) 0;
+#if USE_READAHEAD
+	if (readahead_flag)
+	    start_read_ahead(fin);
+	else
+#endif
+#if USE_MMAP
+	    map_fin_data(fin);
+#endif
     }
 
     return fin;
@@ -178,7 +1104,7 @@ FINsemi_close(FIN * fin)
     static char dead = 0;
 
     if (fin->buff != &dead) {
-	zfree(fin->buff, (size_t) (fin->nbuffs * BUFFSZ + 1));
+	free_fin_buffer(fin);
 
 	if (fin->fd) {
 	    if (fin->fp)
@@ -202,6 +1128,10 @@ FINclose(FIN * fin)
     ZFREE(fin);
 }
 
+/* initial size of the part of a mapped file searched for a regular
+   expression RS */
+#define RE_WINDOW 1024
+
 /* return one input record as determined by RS,
    from input file (FIN)  fin
 */
@@ -211,12 +1141,23 @@ FINgets(FIN * fin, size_t *len_p)
 {
     char *p;
     char *q = 0;
+    char *more = 0;		/* where to resume if no match */
+    size_t skip;		/* ...and that, relative to p */
+    char *lim;
+    size_t window;
     size_t match_len;
     size_t r;
 
   restart:
+    skip = 0;
+    window = RE_WINDOW;
 
     if ((p = fin->buffp) >= fin->limit) {	/* need a refill */
+#if USE_MMAP
+	if ((fin->flags & MMAP_FLAG) && (fin->flags & EOF_FLAG)
+	    && map_grown(fin))
+	    goto restart;
+#endif
 	if (fin->flags & EOF_FLAG) {
 	    if (fin->flags & MAIN_FLAG) {
 		fin = next_main(0);
@@ -229,7 +1170,7 @@ FINgets(FIN * fin, size_t *len_p)
 
 	if (fin->fp) {
 	    /* line buffering */
-	    if (!fgets(fin->buff, BUFFSZ + 1, fin->fp)) {
+	    if (!fgets(fin->buff, (int) FinBuffSize(fin) + 1, fin->fp)) {
 		fin->flags |= EOF_FLAG;
 		fin->buff[0] = 0;
 		fin->buffp = fin->buff;
@@ -248,15 +1189,26 @@ FINgets(FIN * fin, size_t *len_p)
 		return fin->buff;
 	    }
 	} else {
-	    /* block buffering */
-	    r = fillbuff(fin->fd, fin->buff, (size_t) (fin->nbuffs * BUFFSZ));
-	    if (r == 0) {
-		fin->flags |= EOF_FLAG;
-		fin->buffp = fin->buff;
-		fin->limit = fin->buffp;
-		goto restart;	/* might be main */
-	    } else if (r < fin->nbuffs * BUFFSZ) {
+#if USE_MMAP
+	    if (fin->flags & MMAP_FLAG) {
+		/* the whole file is already in memory */
+		r = fin->mapped;
 		fin->flags |= EOF_FLAG;
+		/* leave the offset where reading would have */
+		(void) lseek(fin->fd, (off_t) r, SEEK_SET);
+	    } else
+#endif
+	    {
+		/* block buffering */
+		r = fin_fill(fin, fin->buff, FinBuffSize(fin));
+		if (r == 0) {
+		    fin->flags |= EOF_FLAG;
+		    fin->buffp = fin->buff;
+		    fin->limit = fin->buffp;
+		    goto restart;	/* might be main */
+		} else if (r < FinBuffSize(fin)) {
+		    fin->flags |= EOF_FLAG;
+		}
 	    }
 
 	    fin->limit = fin->buff + r;
@@ -280,33 +1232,98 @@ FINgets(FIN * fin, size_t *len_p)
 
     switch (rs_shadow.type) {
     case SEP_CHAR:
-	q = memchr(p, rs_shadow.c, (size_t) (fin->limit - p));
+	q = memchr(p + skip, rs_shadow.c, (size_t) (fin->limit - p) - skip);
 	match_len = 1;
+	more = fin->limit;
 	break;
 
     case SEP_STR:
-	q = str_str(p,
-		    (size_t) (fin->limit - p),
-		    ((STRING *) rs_shadow.ptr)->str,
-		    match_len = ((STRING *) rs_shadow.ptr)->len);
+	match_len = ((STRING *) rs_shadow.ptr)->len;
+#if USE_RS_INDEX
+	if (rs_index_ok())
+	    q = indexed_sep(fin, p + skip);
+	else
+#endif
+	    q = str_str(p + skip,
+			(size_t) (fin->limit - p) - skip,
+			((STRING *) rs_shadow.ptr)->str,
+			match_len);
+	/* a separator may straddle the end of the buffer */
+	more = ((size_t) (fin->limit - p) >= match_len)
+	    ? fin->limit - match_len + 1
+	    : p;
 	break;
 
     case SEP_MLR:
     case SEP_RE:
-	q = re_pos_match(p, (size_t) (fin->limit - p), rs_shadow.ptr, &match_len);
+	lim = fin->limit;
+#if USE_MMAP && defined(LOCAL_REGEXP)
+	/* A mapped file is one big buffer.  Search it a window at a time,
+	   else a pattern which fails only at the end of the buffer makes
+	   each record cost the rest of the file.  (regexec() ignores the
+	   length, so there is no window for the system's regex.)  */
+	if ((fin->flags & MMAP_FLAG) && (size_t) (lim - p) > window)
+	    lim = p + window;
+#endif
+	q = re_pos_resume(p, (size_t) (lim - p), p + skip,
+			  rs_shadow.ptr, &match_len, &more);
 	/* if the match is at the end, there might still be
 	   more to match in the file */
-	if (q && q[match_len] == 0 && !(fin->flags & EOF_FLAG))
+	if (q && q + match_len >= lim
+	    && (lim < fin->limit || !(fin->flags & EOF_FLAG))) {
+	    if (q < more)
+		more = q;
 	    q = (char *) 0;
+	}
+	/* Nor does a match stand while an attempt starting at or before
+	   it was still going at the end of what was searched:  a longer
+	   or earlier match may follow, as it would for the whole file.
+	   (The system's regex cannot tell us that.)  */
+#ifdef LOCAL_REGEXP
+	if (q && more <= q
+	    && (lim < fin->limit || !(fin->flags & EOF_FLAG)))
+	    q = (char *) 0;
+#endif
+	if (q == 0 && lim < fin->limit) {
+	    skip = (size_t) (more - p);
+	    window *= 2;
+	    goto retry;
+	}
 	break;
 
     default:
 	bozo("type of rs_shadow");
     }
 
+#if USE_MMAP
+    if (fin->flags & MMAP_FLAG) {
+	if (fin->map->shrunk) {
+	    /* the search ran into a truncated part of the file */
+	    map_shrunk(fin);
+#if USE_RS_INDEX
+	    if (fin->rsx)
+		fin->rsx->base = 0;
+#endif
+	    if (p >= fin->limit)
+		goto restart;
+	    skip = 0;
+	    window = RE_WINDOW;
+	    goto retry;
+	}
+	if (q == 0 && (fin->flags & EOF_FLAG)) {
+	    skip = (size_t) (more - p);
+	    if (map_grown(fin)) {
+		p = fin->buffp;
+		goto retry;
+	    }
+	}
+    }
+#endif
+
     if (q) {
 	/* the easy and normal case */
-	*q = 0;
+	if (!(fin->flags & MMAP_FLAG))
+	    *q = 0;
 	*len_p = (unsigned) (q - p);
 	fin->buffp = q + match_len;
 	return p;
@@ -320,12 +1337,18 @@ FINgets(FIN * fin, size_t *len_p)
 	if (rs_shadow.type == SEP_MLR && fin->buffp[-1] == '\n'
 	    && r != 0) {
 	    (*len_p)--;
-	    *--fin->buffp = 0;
+	    if (fin->flags & MMAP_FLAG)
+		--fin->buffp;
+	    else
+		*--fin->buffp = 0;
 	    fin->limit--;
 	}
 	return p;
     }
 
+    /* the text before "more" need not be searched again */
+    skip = (size_t) (more - p);
+
     if (p == fin->buff) {
 	/* current record is too big for the input buffer, grow buffer */
 	p = enlarge_fin_buffer(fin);
@@ -336,9 +1359,9 @@ FINgets(FIN * fin, size_t *len_p)
 
 	p = (char *) memmove(fin->buff, p, r = (size_t) (fin->limit - p));
 	q = p + r;
-	rr = fin->nbuffs * BUFFSZ - r;
+	rr = FinBuffSize(fin) - r;
 
-	if ((r = fillbuff(fin->fd, q, rr)) < rr) {
+	if ((r = fin_fill(fin, q, rr)) < rr) {
 	    fin->flags |= EOF_FLAG;
 	    fin->limit = fin->buff + amount + r;
 	}
@@ -346,28 +1369,37 @@ FINgets(FIN * fin, size_t *len_p)
     goto retry;
 }
 
+/*
+ * Double the buffer, so that reading a huge record costs time linear
+ * in its length.
+ */
 static char *
 enlarge_fin_buffer(FIN * fin)
 {
     size_t r;
-    size_t oldsize = fin->nbuffs * BUFFSZ + 1;
+    size_t more = FinBuffSize(fin);
+    size_t oldsize = more + 1;
     size_t limit = (size_t) (fin->limit - fin->buff);
 
 #ifdef  MSDOS
     /* I'm not sure this can really happen:
        avoid "16bit wrap" */
-    if (fin->nbuffs == MAX_BUFFS) {
+    if (fin->nbuffs * 2 > MAX_BUFFS) {
 	errmsg(0, "out of input buffer space");
 	mawk_exit(2);
     }
 #endif
+    if (fin->nbuffs > MAX__UINT / 2 || oldsize + more < oldsize) {
+	errmsg(0, "out of input buffer space");
+	mawk_exit(2);
+    }
 
     fin->buffp =
-	fin->buff = (char *) zrealloc(fin->buff, oldsize, oldsize + BUFFSZ);
-    fin->nbuffs++;
+	fin->buff = (char *) zrealloc(fin->buff, oldsize, oldsize + more);
+    fin->nbuffs *= 2;
 
-    r = fillbuff(fin->fd, fin->buff + (oldsize - 1), (size_t) BUFFSZ);
-    if (r < BUFFSZ)
+    r = fin_fill(fin, fin->buff + (oldsize - 1), more);
+    if (r < more)
 	fin->flags |= EOF_FLAG;
 
     fin->limit = fin->buff + limit + r;
@@ -404,6 +1436,26 @@ fillbuff(int fd, char *target, size_t size)
     return (size_t) (entry_size - size);
 }
 
+/* fill the FIN buffer, from the reader thread if there is one */
+static size_t
+fin_fill(FIN * fin, char *target, size_t size)
+{
+#if USE_RS_INDEX
+    /* the data has moved or changed */
+    if (fin->rsx)
+	fin->rsx->base = 0;
+#endif
+#if USE_READAHEAD
+    if (fin->ahead)
+	return read_ahead_fill(fin->ahead, target, size);
+#endif
+#if USE_UNZIP
+    if (fin->unzip)
+	return unzip_fill(fin->unzip, target, size);
+#endif
+    return fillbuff(fin->fd, target, size);
+}
+
 /* main_fin is a handle to the main input stream
    == 0	 never been opened   */
 
@@ -454,6 +1506,152 @@ open_main(void)
 	next_main(1);
 }
 
+#if USE_PREFETCH
+/*
+ * When the main input is many files, e.g., a day of log shards on slow
+ * storage, the first read of each file stalls.  So once a file is opened,
+ * the next fin_prefetch regular files named in ARGV are opened too, and
+ * the kernel is asked to start reading them.  This is only a hint:
+ * next_main() still decides what to open when it gets there, using a
+ * prefetched descriptor only if ARGV still names the same file.
+ */
+#define PREFETCH_SZ	(256 * BUFFSZ)	/* bytes to ask for at first */
+
+static struct {
+    STRING *name;
+    int fd;
+} prefetched[MAX_PREFETCH];
+static int num_prefetched;
+
+/* like is_cmdline_assign(), without making the assignment */
+static int
+looks_like_assign(char *s)
+{
+    int c;
+
+    if (scan_code[*(unsigned char *) s] != SC_IDCHAR)
+	return 0;
+    while ((c = scan_code[*(unsigned char *) ++s]) == SC_IDCHAR
+	   || c == SC_DIGIT) {
+	;
+    }
+    return *s == '=';
+}
+
+static int
+same_name(STRING * a, STRING * b)
+{
+    return a->len == b->len && !memcmp(a->str, b->str, a->len);
+}
+
+static void
+forget_prefetch(int n)
+{
+    close(prefetched[n].fd);
+    free_STRING(prefetched[n].name);
+    prefetched[n] = prefetched[--num_prefetched];
+}
+
+/* open the regular files named next in ARGV, and start reading them */
+static void
+prefetch_main(void)
+{
+    STRING *want[MAX_PREFETCH];
+    int nwant = 0;
+    CELL argc;
+    CELL c_argi;
+    CELL argval;
+    CELL *cp;
+    struct stat sb;
+    int n, k, fd;
+
+    if (cellcpy(&argc, ARGC)->type != C_DOUBLE)
+	cast1_to_d(&argc);
+
+    c_argi.type = C_DOUBLE;
+    for (c_argi.dval = argi;
+	 c_argi.dval < argc.dval && nwant < fin_prefetch;
+	 c_argi.dval += 1.0) {
+	if (!(cp = array_find(Argv, &c_argi, NO_CREATE)))
+	    continue;
+	cp = cellcpy(&argval, cp);
+	if (cp->type < C_STRING)
+	    cast1_to_s(cp);
+	if (string(cp)->len != 0
+	    && strcmp(string(cp)->str, "-")
+	    && !looks_like_assign(string(cp)->str)) {
+	    want[nwant++] = string(cp);
+	} else {
+	    cell_destroy(cp);
+	}
+    }
+
+    /* forget files which ARGV no longer names next */
+    for (n = 0; n < num_prefetched;) {
+	for (k = 0; k < nwant; ++k) {
+	    if (same_name(want[k], prefetched[n].name))
+		break;
+	}
+	if (k < nwant)
+	    ++n;
+	else
+	    forget_prefetch(n);
+    }
+
+    for (k = 0; k < nwant; ++k) {
+	for (n = 0; n < num_prefetched; ++n) {
+	    if (same_name(want[k], prefetched[n].name))
+		break;
+	}
+	/* opening a fifo or device early could block or lose data */
+	if (n == num_prefetched
+	    && stat(want[k]->str, &sb) == 0
+	    && S_ISREG(sb.st_mode)
+	    && (fd = open(want[k]->str, O_RDONLY, 0)) != -1) {
+#ifdef FD_CLOEXEC
+	    (void) fcntl(fd, F_SETFD, FD_CLOEXEC);
+#endif
+	    (void) posix_fadvise(fd, (off_t) 0, (off_t) PREFETCH_SZ,
+				 POSIX_FADV_WILLNEED);
+	    TRACE(("prefetch %s on fd %d\n", want[k]->str, fd));
+	    prefetched[num_prefetched].name = want[k];
+	    prefetched[num_prefetched].fd = fd;
+	    ++num_prefetched;
+	} else {
+	    free_STRING(want[k]);
+	}
+    }
+}
+
+/* return the prefetched descriptor for name, or -1 */
+static int
+take_prefetch(STRING * name)
+{
+    struct stat sb, fsb;
+    int n;
+    int fd = -1;
+
+    for (n = 0; n < num_prefetched; ++n) {
+	if (same_name(name, prefetched[n].name)) {
+	    /* the name might have been given to another file since */
+	    if (stat(name->str, &sb) == 0
+		&& fstat(prefetched[n].fd, &fsb) == 0
+		&& sb.st_dev == fsb.st_dev
+		&& sb.st_ino == fsb.st_ino) {
+		fd = prefetched[n].fd;
+		prefetched[n].fd = -1;
+		free_STRING(prefetched[n].name);
+		prefetched[n] = prefetched[--num_prefetched];
+	    } else {
+		forget_prefetch(n);
+	    }
+	    break;
+	}
+    }
+    return fd;
+}
+#endif /* USE_PREFETCH */
+
 /* get the next command line file open */
 static FIN *
 next_main(int open_flag)	/* called by open_main() if on */
@@ -464,6 +1662,9 @@ next_main(int open_flag)	/* called by open_main() if on */
     CELL c_argi;		/* cell copy of argi */
     CELL argval;		/* copy of ARGV[c_argi] */
     int failed = 1;
+#if USE_PREFETCH
+    int fd;
+#endif
 
     argval.type = C_NOINIT;
     c_argi.type = C_DOUBLE;
@@ -508,6 +1709,11 @@ next_main(int open_flag)	/* called by open_main() if on */
 
 	/* try to open it -- we used to continue on failure,
 	   but posix says we should quit */
+#if USE_PREFETCH
+	if ((fd = take_prefetch(string(cp))) != -1)
+	    main_fin = FINdopen(fd, 1);
+	else
+#endif
 	if (!(main_fin = FINopen(string(cp)->str, 1))) {
 	    errmsg(errno, "cannot open %s", string(cp)->str);
 	    mawk_exit(2);
@@ -523,6 +1729,10 @@ next_main(int open_flag)	/* called by open_main() if on */
 	rt_fnr = 0;
 
 	failed = 0;
+#if USE_PREFETCH
+	if (fin_prefetch > 0)
+	    prefetch_main();
+#endif
 	break;
     }
 
@@ -31,6 +31,11 @@ the GNU General Public License, version 2, 1991.
 
 #include <stdio.h>
 
+struct read_ahead;		/* private to fin.c */
+struct rs_index;		/* private to fin.c */
+struct unzip;			/* private to fin.c */
+struct fin_map;			/* private to fin.c */
+
 /* structure to control input files */
 
 typedef struct {
@@ -39,13 +44,19 @@ typedef struct {
     char *buff;			/* base of data read from file */
     char *buffp;		/* current position to read-next */
     char *limit;		/* points past the data in *buff */
-    unsigned nbuffs;		/* sizeof *buff in BUFFSZs */
+    unsigned nbuffs;		/* sizeof *buff in fin_chunks */
     int flags;
+    size_t mapped;		/* length of file mapped at *buff, if MMAP_FLAG */
+    struct read_ahead *ahead;	/* reader thread, if -W readahead */
+    struct rs_index *rsx;	/* separators found in buff, if any */
+    struct unzip *unzip;	/* decompressor, if the file is compressed */
+    struct fin_map *map;	/* the mapping, if MMAP_FLAG */
 } FIN;
 
 #define  MAIN_FLAG    1		/* part of main input stream if on */
 #define  EOF_FLAG     2
 #define  START_FLAG   4		/* used when RS == "" */
+#define  MMAP_FLAG    8		/* buff is a read-only mapping of the file */
 
 FIN *FINdopen(int, int);
 FIN *FINopen(char *, int);
@@ -55,6 +66,12 @@ char *FINgets(FIN *, size_t *);
 size_t fillbuff(int, char *, size_t);
 
 extern FIN *main_fin;		/* for the main input stream */
+extern size_t fin_chunk;	/* starting buffer size, -W chunk */
+extern int fin_prefetch;	/* files to open ahead, -W prefetch */
+extern int fin_decompress;	/* -W decompress */
+extern int fin_mmap;		/* -W mmap */
+
+#define MAX_PREFETCH	64
 void open_main(void);
 
 #endif /* FIN_H */
@@ -70,6 +70,9 @@ the GNU General Public License, version 2, 1991.
 #include "bi_vars.h"
 #include "files.h"
 #include "field.h"
+#include "fin.h"
+#include "repl.h"
+#include "regexp.h"
 #include <stdlib.h>
 
 #include <ctype.h>
@@ -85,10 +88,24 @@ typedef enum {
 #endif
     W_VERSION,
     W_DUMP,
+    W_DECOMPRESS,
+    W_MMAP,
     W_INTERACTIVE,
     W_EXEC,
     W_SPRINTF,
-    W_POSIX_SPACE
+    W_POSIX_SPACE,
+    W_READAHEAD,
+    W_CHUNK,
+    W_PARALLEL,
+    W_REDUCE,
+    W_PREFETCH,
+    W_RE_CACHE,
+    W_RE_MEMORY,
+    W_RE_STATS,
+    W_RE_PROFILE,
+    W_RE_LINEAR,
+    W_RE_JIT,
+    W_IGNORECASE
 } W_OPTIONS;
 
 static void process_cmdline(int, char **);
@@ -104,6 +121,7 @@ void reargv(int *, char ***);
 
 char *progname;
 short interactive_flag = 0;
+short readahead_flag = 0;
 
 #ifndef	 SET_PROGNAME
 #define	 SET_PROGNAME() \
@@ -217,10 +235,24 @@ parse_w_opt(char *source, char **next)
 	    DATA(BINMODE),
 #endif
 	    DATA(DUMP),
+	    DATA(DECOMPRESS),
+	    DATA(MMAP),
 	    DATA(INTERACTIVE),
 	    DATA(EXEC),
 	    DATA(SPRINTF),
-	    DATA(POSIX_SPACE)
+	    DATA(POSIX_SPACE),
+	    DATA(READAHEAD),
+	    DATA(CHUNK),
+	    DATA(PARALLEL),
+	    DATA(REDUCE),
+	    DATA(PREFETCH),
+	    DATA(RE_CACHE),
+	    DATA(RE_MEMORY),
+	    DATA(RE_STATS),
+	    DATA(RE_PROFILE),
+	    DATA(RE_LINEAR),
+	    DATA(RE_JIT),
+	    DATA(IGNORECASE)
     };
 #undef DATA
     W_OPTIONS result = W_UNKNOWN;
@@ -240,11 +272,12 @@ parse_w_opt(char *source, char **next)
 	}
 	for (n = 0; n < (int) (sizeof(w_options) / sizeof(w_options[0])); ++n) {
 	    if (ok_abbrev(w_options[n].name, first, (int) (source - first))) {
-		if (match >= 0) {
+		/* the documented one-letter forms take the first match */
+		if (match >= 0 && (source - first) > 1) {
 		    errmsg(0, "? ambiguous -W value: %s vs %s\n",
 			   w_options[match].name,
 			   w_options[n].name);
-		} else {
+		} else if (match < 0) {
 		    match = n;
 		}
 	    }
@@ -340,6 +373,40 @@ process_cmdline(int argc, char **argv)
 		    dump_code_flag = 1;
 		    break;
 
+		case W_DECOMPRESS:
+		    if (haveValue(optNext)) {
+			long x = atol(optNext + 1);
+
+			if (x < 0 || x > 1) {
+			    errmsg(0, "improper value for -W decompress: %s",
+				   optNext + 1);
+			    mawk_exit(2);
+			}
+			fin_decompress = (int) x;
+			optNext = skipValue(optNext);
+		    } else {
+			errmsg(0, "missing value for -W decompress");
+			mawk_exit(2);
+		    }
+		    break;
+
+		case W_MMAP:
+		    if (haveValue(optNext)) {
+			long x = atol(optNext + 1);
+
+			if (x < 0 || x > 1) {
+			    errmsg(0, "improper value for -W mmap: %s",
+				   optNext + 1);
+			    mawk_exit(2);
+			}
+			fin_mmap = (int) x;
+			optNext = skipValue(optNext);
+		    } else {
+			errmsg(0, "missing value for -W mmap");
+			mawk_exit(2);
+		    }
+		    break;
+
 		case W_EXEC:
 		    if (pfile_name) {
 			errmsg(0, "-W exec is incompatible with -f");
@@ -360,6 +427,169 @@ process_cmdline(int argc, char **argv)
 		    posix_space_flag = 1;
 		    break;
 
+		case W_CHUNK:
+		    if (haveValue(optNext)) {
+			long x = atol(optNext + 1);
+
+			if (x <= 0 || x > MAX_CHUNK) {
+			    errmsg(0, "improper value for -W chunk: %s",
+				   optNext + 1);
+			    mawk_exit(2);
+			}
+			fin_chunk = (size_t) x;
+			optNext = skipValue(optNext);
+		    } else {
+			errmsg(0, "missing value for -W chunk");
+			mawk_exit(2);
+		    }
+		    break;
+
+		case W_PARALLEL:
+		    if (haveValue(optNext)) {
+			long x = atol(optNext + 1);
+
+			if (x <= 0 || x > 1024) {
+			    errmsg(0, "improper value for -W parallel: %s",
+				   optNext + 1);
+			    mawk_exit(2);
+			}
+#if USE_PARALLEL
+			parallel_jobs = (int) x;
+#else
+			errmsg(0, "-W parallel is not supported on this system");
+#endif
+			optNext = skipValue(optNext);
+		    } else {
+			errmsg(0, "missing value for -W parallel");
+			mawk_exit(2);
+		    }
+		    break;
+
+		case W_REDUCE:
+		    if (haveValue(optNext)) {
+			char *value = optNext + 1;
+
+			optNext = skipValue(optNext);
+#if USE_PARALLEL
+			parallel_reduce(value, (size_t) (optNext - value));
+#else
+			(void) value;
+#endif
+		    } else {
+			errmsg(0, "missing value for -W reduce");
+			mawk_exit(2);
+		    }
+		    break;
+
+		case W_PREFETCH:
+		    if (haveValue(optNext)) {
+			long x = atol(optNext + 1);
+
+			if (x < 0 || x > MAX_PREFETCH) {
+			    errmsg(0, "improper value for -W prefetch: %s",
+				   optNext + 1);
+			    mawk_exit(2);
+			}
+#ifdef HAVE_POSIX_FADVISE
+			fin_prefetch = (int) x;
+#else
+			if (x != 0)
+			    errmsg(0, "-W prefetch is not supported on this system");
+#endif
+			optNext = skipValue(optNext);
+		    } else {
+			errmsg(0, "missing value for -W prefetch");
+			mawk_exit(2);
+		    }
+		    break;
+
+		case W_RE_CACHE:
+		    if (haveValue(optNext)) {
+			long x = atol(optNext + 1);
+
+			if (x < 0) {
+			    errmsg(0, "improper value for -W re_cache: %s",
+				   optNext + 1);
+			    mawk_exit(2);
+			}
+			re_cache_entries = (size_t) x;
+			optNext = skipValue(optNext);
+		    } else {
+			errmsg(0, "missing value for -W re_cache");
+			mawk_exit(2);
+		    }
+		    break;
+
+		case W_RE_MEMORY:
+		    if (haveValue(optNext)) {
+			long x = atol(optNext + 1);
+
+			if (x < 0) {
+			    errmsg(0, "improper value for -W re_memory: %s",
+				   optNext + 1);
+			    mawk_exit(2);
+			}
+			re_cache_bytes = (size_t) x;
+			optNext = skipValue(optNext);
+		    } else {
+			errmsg(0, "missing value for -W re_memory");
+			mawk_exit(2);
+		    }
+		    break;
+
+		case W_RE_STATS:
+		    re_stats_flag = 1;
+		    break;
+
+		case W_RE_PROFILE:
+		    re_profile_flag = 1;
+		    break;
+
+		case W_RE_LINEAR:
+		    if (haveValue(optNext)) {
+			long x = atol(optNext + 1);
+
+			if (x <= 0) {
+			    errmsg(0, "improper value for -W re_linear: %s",
+				   optNext + 1);
+			    mawk_exit(2);
+			}
+			RE_backtrack = (int) x;
+			optNext = skipValue(optNext);
+		    } else {
+			RE_backtrack = 0;
+		    }
+		    break;
+
+		case W_RE_JIT:
+		    if (haveValue(optNext)) {
+			long x = atol(optNext + 1);
+
+			if (x < 0 || x > 1) {
+			    errmsg(0, "improper value for -W re_jit: %s",
+				   optNext + 1);
+			    mawk_exit(2);
+			}
+			RE_jit_flag = (int) x;
+			optNext = skipValue(optNext);
+		    } else {
+			errmsg(0, "missing value for -W re_jit");
+			mawk_exit(2);
+		    }
+		    break;
+
+		case W_IGNORECASE:
+		    RE_fold = 1;
+		    break;
+
+		case W_READAHEAD:
+#if defined(HAVE_PTHREAD_H) && defined(HAVE_LIBPTHREAD)
+		    readahead_flag = 1;
+#else
+		    errmsg(0, "-W readahead is not supported on this system");
+#endif
+		    break;
+
 		case W_SPRINTF:
 		    if (haveValue(optNext)) {
 			int x = atoi(optNext + 1);
@@ -49,6 +49,7 @@ the GNU General Public License, version 2, 1991.
 #include "init.h"
 #include "code.h"
 #include "files.h"
+#include "repl.h"
 
 #ifdef LOCALE
 #include <locale.h>
@@ -83,6 +84,18 @@ main(int argc, char **argv)
 void
 mawk_exit(int x)
 {
+#if USE_PARALLEL
+    /* the parent owns the output files and pipes */
+    if (parallel_worker)
+	_exit(x);
+#endif
+
+    /* before stderr is closed along with the other output files */
+    if (re_stats_flag)
+	re_report();
+    if (re_profile_flag)
+	re_prof_report();
+
 #ifdef  HAVE_REAL_PIPES
     close_out_pipes();		/* no effect, if no out pipes */
 #else
@@ -86,6 +86,21 @@ extern int dump_RE;
 #endif
 
 extern short posix_space_flag, interactive_flag;
+extern short readahead_flag;
+
+#if defined(HAVE_REAL_PIPES) && defined(HAVE_FORK) && defined(HAVE_MMAP)
+#define USE_PARALLEL 1
+#else
+#define USE_PARALLEL 0
+#endif
+
+#if USE_PARALLEL
+extern int parallel_jobs;	/* -W parallel */
+extern short parallel_worker;	/* true in a forked worker */
+extern void parallel_reduce(const char *, size_t);
+extern void parallel_main(void);
+extern void parallel_finish(void) GCC_NORETURN;
+#endif
 
 /*----------------
  *  GLOBAL VARIABLES
@@ -177,6 +192,7 @@ extern void mawk_exit(int) GCC_NORETURN;
 extern void da(INST *, FILE *);
 extern char *rm_escape(char *, size_t *);
 extern char *re_pos_match(char *, size_t, PTR, size_t *);
+extern char *re_pos_resume(char *, size_t, char *, PTR, size_t *, char **);
 extern int binmode(void);
 
 #ifndef  REXP_H
@@ -0,0 +1,1001 @@
+/********************************************
+parallel.c
+copyright 2026, Thomas E. Dickey
+
+This is a source file for mawk, an implementation of
+the AWK programming language.
+
+Mawk is distributed without warranty under the terms of
+the GNU General Public License, version 2, 1991.
+********************************************/
+
+/*
+ * $MawkId: parallel.c,v 1.1 2026/10/16 00:00:00 tom Exp $
+ */
+
+/*
+ * -W parallel=N splits a single mapped input file into N pieces, each
+ * ending with a record separator, and forks a worker to run the main rules
+ * over each piece.  A worker ends by writing the changes it made to global
+ * variables and arrays on a pipe; the parent merges those, in the order
+ * of the pieces, and then runs END as if it had read the file itself.
+ *
+ * Only programs whose main rules are independent of the order of records
+ * are run this way.  Anything else (getline, output, NR, range patterns
+ * and so forth) is refused with a warning, and the input is read serially.
+ *
+ * Changes are merged with the reducer declared by -W reduce=how:name...
+ * There is no safe guess for the others, so if END reads a global which the
+ * main rules change without a declaration, the input is read serially.
+ */
+
+#include "mawk.h"
+#include "code.h"
+#include "symtype.h"
+#include "memory.h"
+#include "bi_funct.h"
+#include "bi_vars.h"
+#include "field.h"
+#include "files.h"
+#include "fin.h"
+
+#if USE_PARALLEL
+
+#include <unistd.h>
+
+int parallel_jobs = 1;
+short parallel_worker = 0;
+
+typedef enum {
+    R_DEFAULT = 0,
+    R_SUM,
+    R_MIN,
+    R_MAX,
+    R_CONCAT
+} REDUCER;
+
+/* -W reduce declarations, looked up when the workers are started */
+typedef struct reduce_decl {
+    struct reduce_decl *link;
+    char *name;
+    REDUCER how;
+} REDUCE_DECL;
+
+static REDUCE_DECL *reduce_list;
+
+/* a global which the main rules might change */
+typedef struct {
+    CELL *cp;			/* a scalar, or */
+    ARRAY A;			/* an array */
+    CELL base;			/* value of the scalar before the main rules */
+    ARRAY base_A;		/* copy of the array before the main rules */
+    REDUCER how;
+    short read;			/* END reads it */
+} SHARED;
+
+static SHARED *shared_list;
+static unsigned num_shared;
+static unsigned max_shared;
+
+/* functions already looked at, to stop recursion */
+static FBLOCK **seen_list;
+static unsigned num_seen;
+static unsigned max_seen;
+
+static short scan_end;		/* noting what END reads, not what changes */
+
+static FILE *to_parent;		/* in a worker */
+static unsigned worker_nr;	/* rt_nr when a worker started */
+
+/* how each change is merged */
+#define OP_END		'\0'
+#define OP_SUM		'S'	/* add a difference */
+#define OP_MIN		'm'
+#define OP_MAX		'M'
+#define OP_CONCAT	'C'	/* append a suffix */
+#define OP_LAST		'L'	/* replace the value */
+#define OP_CREATE	'N'	/* create an element, if it does not exist */
+#define OP_DELETE	'D'
+
+void
+parallel_reduce(const char *value, size_t len)
+{
+    static const struct {
+	REDUCER how;
+	const char *name;
+    } reducers[] = {
+	{ R_SUM, "sum" },
+	{ R_MIN, "min" },
+	{ R_MAX, "max" },
+	{ R_CONCAT, "concat" }
+    };
+    REDUCER how = R_DEFAULT;
+    const char *s = memchr(value, ':', len);
+    size_t n;
+
+    if (s != 0) {
+	for (n = 0; n < sizeof(reducers) / sizeof(reducers[0]); ++n) {
+	    if (strlen(reducers[n].name) == (size_t) (s - value)
+		&& !memcmp(reducers[n].name, value, (size_t) (s - value))) {
+		how = reducers[n].how;
+		break;
+	    }
+	}
+    }
+    if (how == R_DEFAULT || s + 1 == value + len) {
+	errmsg(0, "improper value for -W reduce: %.*s", (int) len, value);
+	mawk_exit(2);
+    }
+
+    while (s < value + len) {
+	const char *name = ++s;
+	REDUCE_DECL *p;
+
+	while (s < value + len && *s != ':')
+	    ++s;
+	p = ZMALLOC(REDUCE_DECL);
+	p->name = (char *) zmalloc((size_t) (s - name) + 1);
+	memcpy(p->name, name, (size_t) (s - name));
+	p->name[s - name] = '\0';
+	p->how = how;
+	p->link = reduce_list;
+	reduce_list = p;
+    }
+}
+
+static void
+add_shared(CELL * cp, ARRAY A)
+{
+    unsigned n;
+
+    for (n = 0; n < num_shared; ++n) {
+	if (shared_list[n].cp == cp && shared_list[n].A == A)
+	    return;
+    }
+    if (num_shared == max_shared) {
+	size_t old = max_shared * sizeof(SHARED);
+
+	max_shared = max_shared ? 2 * max_shared : 16;
+	shared_list = (SHARED *) (old
+				  ? zrealloc(shared_list, old,
+					     max_shared * sizeof(SHARED))
+				  : zmalloc(max_shared * sizeof(SHARED)));
+    }
+    memset(&shared_list[num_shared], 0, sizeof(SHARED));
+    shared_list[num_shared].cp = cp;
+    shared_list[num_shared].A = A;
+    ++num_shared;
+}
+
+static void
+note_read(CELL * cp, ARRAY A)
+{
+    unsigned n;
+
+    for (n = 0; n < num_shared; ++n) {
+	if (shared_list[n].cp == cp && shared_list[n].A == A)
+	    shared_list[n].read = 1;
+    }
+}
+
+/* the special variables kept in field[] are not globals to merge */
+#define is_pseudo_field(cp) ((cp) >= NF && (cp) <= LAST_PFIELD)
+
+static const char *scan_code(INST *);
+
+static const char *
+scan_funct(FBLOCK * fbp)
+{
+    unsigned n;
+
+    for (n = 0; n < num_seen; ++n) {
+	if (seen_list[n] == fbp)
+	    return 0;
+    }
+    if (num_seen == max_seen) {
+	size_t old = max_seen * sizeof(FBLOCK *);
+
+	max_seen = max_seen ? 2 * max_seen : 16;
+	seen_list = (FBLOCK **) (old
+				 ? zrealloc(seen_list, old,
+					    max_seen * sizeof(FBLOCK *))
+				 : zmalloc(max_seen * sizeof(FBLOCK *)));
+    }
+    seen_list[num_seen++] = fbp;
+    return scan_code(fbp->code);
+}
+
+/*
+ * Walk the code of the main rules (and the functions they call), noting
+ * the globals they assign.  Return the reason the code cannot be run in
+ * pieces, or null if it can.  With scan_end set, walk END instead, noting
+ * which of those globals it reads.
+ */
+static const char *
+scan_code(INST * p)
+{
+    const char *why = 0;
+    CELL *cp;
+    PF_CP bi;
+
+    while (why == 0 && p->op != _HALT) {
+	switch (p++->op) {
+	case _PUSHA:
+	    cp = (CELL *) p++->ptr;
+	    if (scan_end)
+		note_read(cp, (ARRAY) 0);
+	    else if (cp == NR || cp == FNR)
+		why = "program uses NR";
+	    else
+		add_shared(cp, (ARRAY) 0);
+	    break;
+
+	case _PUSHI:
+	    cp = (CELL *) p++->ptr;
+	    if (scan_end)
+		note_read(cp, (ARRAY) 0);
+	    else if (cp == NR || cp == FNR)
+		why = "program uses NR";
+	    break;
+
+	case AE_PUSHA:
+	case A_PUSHA:
+	    if (scan_end)
+		note_read((CELL *) 0, (ARRAY) p++->ptr);
+	    else
+		add_shared((CELL *) 0, (ARRAY) p++->ptr);
+	    break;
+
+	case AE_PUSHI:
+	    if (scan_end)
+		note_read((CELL *) 0, (ARRAY) p->ptr);
+	    p++;
+	    break;
+
+	case F_PUSHA:
+	    cp = (CELL *) p++->ptr;
+	    if (cp != NF && is_pseudo_field(cp))
+		why = "program assigns RS, FS, CONVFMT or OFMT";
+	    break;
+
+	case _BUILTIN:
+	    bi = (PF_CP) p++->ptr;
+	    if (bi == bi_getline)
+		why = "program uses getline";
+	    else if (bi == bi_system || bi == bi_close || bi == bi_fflush)
+		why = "program uses system, close or fflush";
+	    else if (bi == bi_rand || bi == bi_srand)
+		why = "program uses rand";
+	    else if ((bi == bi_match || bi == bi_match3) && !scan_end) {
+		add_shared(RSTART, (ARRAY) 0);
+		add_shared(RLENGTH, (ARRAY) 0);
+	    }
+	    break;
+
+	case _PRINT:
+	    why = "program writes output";
+	    break;
+
+	case _EXIT:
+	case _EXIT0:
+	    why = "program uses exit";
+	    break;
+
+	case _NEXTFILE:
+	    why = "program uses nextfile";
+	    break;
+
+	case _RANGE:
+	    why = "program has a range pattern";
+	    break;
+
+	case _CALL:
+	    why = scan_funct((FBLOCK *) p->ptr);
+	    p += 2;
+	    break;
+
+	case F_PUSHI:
+	    p += 2;
+	    break;
+
+	case _PUSHC:
+	case _PUSHD:
+	case _PUSHS:
+	case _MATCH0:
+	case _MATCH0S:
+	case _MATCH1:
+	case L_PUSHA:
+	case L_PUSHI:
+	case LAE_PUSHI:
+	case LAE_PUSHA:
+	case LA_PUSHA:
+	case _PUSHINT:
+	case _JMP:
+	case _JNZ:
+	case _JZ:
+	case _LJZ:
+	case _LJNZ:
+	case SET_ALOOP:
+	case ALOOP:
+	case A_CAT:
+	    p++;
+	    break;
+
+	default:
+	    break;
+	}
+	/* END may do anything, after the pieces are merged */
+	if (scan_end)
+	    why = 0;
+    }
+    return why;
+}
+
+static const char *
+scan_program(void)
+{
+    static char msg[80];
+    const char *why;
+    REDUCE_DECL *p;
+    SYMTAB *stp;
+    unsigned n;
+
+    if (main_start == 0)
+	return "program has no main rules";
+    if ((why = scan_code(main_start)) != 0)
+	return why;
+
+    /* a reducer matters only for what the main rules change */
+    for (p = reduce_list; p != 0; p = p->link) {
+	stp = find(p->name);
+	for (n = 0; n < num_shared; ++n) {
+	    if ((stp->type == ST_VAR && shared_list[n].cp == stp->stval.cp)
+		|| (stp->type == ST_ARRAY
+		    && shared_list[n].A == stp->stval.array)) {
+		shared_list[n].how = p->how;
+	    }
+	}
+    }
+
+    if (end_start == 0)
+	return 0;
+    num_seen = 0;
+    scan_end = 1;
+    (void) scan_code(end_start);
+    scan_end = 0;
+    for (n = 0; n < num_shared; ++n) {
+	SHARED *sp = &shared_list[n];
+
+	/* print reads OFS and ORS, and a subscript SUBSEP, without pushing
+	   them; CONVFMT and OFMT cannot be changed, see F_PUSHA above */
+	if (sp->how == R_DEFAULT
+	    && (sp->read || sp->cp == OFS || sp->cp == ORS
+		|| sp->cp == SUBSEP)) {
+	    sprintf(msg, "END reads %.40s, with no -W reduce for it",
+		    (sp->A != 0
+		     ? reverse_find(ST_ARRAY, (PTR) & sp->A)
+		     : reverse_find(ST_VAR, (PTR) & sp->cp)));
+	    return msg;
+	}
+    }
+    return 0;
+}
+
+/*
+ * True if ARGV names exactly one file, and nothing else.  Unlike
+ * next_main(), this has no side effects.
+ */
+static int
+one_input_file(void)
+{
+    CELL argc;
+    CELL c_argi;
+    CELL *cp;
+    int files = 0;
+    int result = 1;
+
+    if (cellcpy(&argc, ARGC)->type != C_DOUBLE)
+	cast1_to_d(&argc);
+
+    c_argi.type = C_DOUBLE;
+    for (c_argi.dval = 1.0; c_argi.dval < argc.dval; c_argi.dval += 1.0) {
+	CELL argval;
+
+	if (!(cp = array_find(Argv, &c_argi, NO_CREATE)))
+	    continue;
+	cp = cellcpy(&argval, cp);
+	if (cp->type < C_STRING)
+	    cast1_to_s(cp);
+	if (string(cp)->len != 0) {
+	    /* command line assignments happen in the middle of input */
+	    if (strchr(string(cp)->str, '=') != 0
+		|| !strcmp(string(cp)->str, "-"))
+		result = 0;
+	    ++files;
+	}
+	cell_destroy(cp);
+    }
+    return result && files == 1;
+}
+
+/*
+ * A literal RS which overlaps itself, e.g., "\n\n", cannot be found
+ * starting from an arbitrary place in the file.
+ */
+static int
+rs_splits_anywhere(void)
+{
+    STRING *sval;
+    size_t n;
+
+    switch (rs_shadow.type) {
+    case SEP_CHAR:
+	return 1;
+    case SEP_STR:
+	sval = (STRING *) rs_shadow.ptr;
+	for (n = 1; n < sval->len; ++n) {
+	    if (!memcmp(sval->str, sval->str + n, sval->len - n))
+		return 0;
+	}
+	return 1;
+    default:
+	return 0;
+    }
+}
+
+/* offset just past the first record separator at or after offset */
+static size_t
+next_boundary(char *base, size_t size, size_t offset)
+{
+    char *q;
+    size_t len = 1;
+
+    if (rs_shadow.type == SEP_CHAR) {
+	q = memchr(base + offset, rs_shadow.c, size - offset);
+    } else {
+	STRING *sval = (STRING *) rs_shadow.ptr;
+
+	len = sval->len;
+	q = str_str(base + offset, size - offset, sval->str, len);
+    }
+    return q ? (size_t) (q - base) + len : size;
+}
+
+static void
+set_fin_range(FIN * fin, size_t lo, size_t hi)
+{
+    fin->buffp = fin->buff + lo;
+    fin->limit = fin->buff + hi;
+    fin->flags |= EOF_FLAG;
+    fin->flags &= ~START_FLAG;
+}
+
+static ARRAY
+copy_array(ARRAY A)
+{
+    ARRAY result = new_ARRAY();
+    STRING **keys;
+    size_t size;
+    size_t n;
+    CELL key;
+
+    if (A->size == 0)
+	return result;
+
+    keys = array_loop_vector(A, &size);
+    key.type = C_STRING;
+    for (n = 0; n < size; ++n) {
+	key.ptr = (PTR) keys[n];
+	cellcpy(array_find(result, &key, CREATE),
+		array_find(A, &key, NO_CREATE));
+	free_STRING(keys[n]);
+    }
+    zfree(keys, size * sizeof(STRING *));
+    return result;
+}
+
+/*---------- the worker's side of the pipe ----------*/
+
+static void
+put_bytes(const void *data, size_t len)
+{
+    if (len != 0 && fwrite(data, 1, len, to_parent) != len) {
+	errmsg(errno, "-W parallel: cannot write results");
+	mawk_exit(2);
+    }
+}
+
+static void
+put_string(STRING * sval)
+{
+    put_bytes(&sval->len, sizeof(sval->len));
+    put_bytes(sval->str, sval->len);
+}
+
+static void
+put_double(double d)
+{
+    put_bytes(&d, sizeof(d));
+}
+
+static void
+put_value(CELL * cp)
+{
+    char type = (char) cp->type;
+
+    put_bytes(&type, 1);
+    if (cp->type == C_DOUBLE || cp->type == C_STRNUM)
+	put_double(cp->dval);
+    if (cp->type >= C_STRING)
+	put_string(string(cp));
+}
+
+static double
+num_value(CELL * cp)
+{
+    CELL c;
+    double d;
+
+    if (cp == 0)
+	return 0.0;
+    cellcpy(&c, cp);
+    if (c.type != C_DOUBLE)
+	cast1_to_d(&c);
+    d = c.dval;
+    return d;
+}
+
+static int
+same_value(CELL * a, CELL * b)
+{
+    if (a->type != b->type)
+	return 0;
+    switch (a->type) {
+    case C_NOINIT:
+	return 1;
+    case C_DOUBLE:
+	return a->dval == b->dval;
+    default:
+	return (string(a)->len == string(b)->len
+		&& !memcmp(string(a)->str, string(b)->str, string(a)->len));
+    }
+}
+
+/* send one change, to v from b (null if there was no b) */
+static void
+put_change(unsigned n, STRING * key, CELL * v, CELL * b)
+{
+    SHARED *sp = &shared_list[n];
+    char op;
+    CELL s, t;
+
+    if (v->type == C_NOINIT) {
+	op = OP_CREATE;
+    } else {
+	switch (sp->how) {
+	case R_SUM:
+	    op = OP_SUM;
+	    break;
+	case R_MIN:
+	    op = OP_MIN;
+	    break;
+	case R_MAX:
+	    op = OP_MAX;
+	    break;
+	case R_CONCAT:
+	    op = OP_CONCAT;
+	    break;
+	default:
+	    bozo("parallel reducer");
+	}
+    }
+
+    if (op == OP_CONCAT) {
+	cellcpy(&s, v);
+	if (s.type < C_STRING)
+	    cast1_to_s(&s);
+	t.type = C_NOINIT;
+	if (b != 0) {
+	    cellcpy(&t, b);
+	    if (t.type < C_STRING)
+		cast1_to_s(&t);
+	}
+	if (b == 0
+	    || (string(&t)->len <= string(&s)->len
+		&& !memcmp(string(&t)->str, string(&s)->str, string(&t)->len))) {
+	    size_t skip = b ? string(&t)->len : 0;
+
+	    put_bytes(&op, 1);
+	    put_bytes(&n, sizeof(n));
+	    if (key)
+		put_string(key);
+	    put_bytes(&string(&s)->len, sizeof(size_t));
+	    put_bytes(string(&s)->str + skip, string(&s)->len - skip);
+	    cell_destroy(&s);
+	    cell_destroy(&t);
+	    return;
+	}
+	cell_destroy(&s);
+	cell_destroy(&t);
+	op = OP_LAST;
+    }
+
+    put_bytes(&op, 1);
+    put_bytes(&n, sizeof(n));
+    if (key)
+	put_string(key);
+
+    switch (op) {
+    case OP_SUM:
+	put_double(num_value(v) - num_value(b));
+	break;
+    case OP_MIN:
+    case OP_MAX:
+	put_double(num_value(v));
+	break;
+    case OP_LAST:
+	put_value(v);
+	break;
+    }
+}
+
+static void
+put_array_changes(unsigned n)
+{
+    SHARED *sp = &shared_list[n];
+    STRING **keys;
+    size_t size;
+    size_t k;
+    CELL key;
+    CELL *b;
+    char op = OP_DELETE;
+
+    key.type = C_STRING;
+    if (sp->A->size != 0) {
+	keys = array_loop_vector(sp->A, &size);
+	for (k = 0; k < size; ++k) {
+	    CELL *v;
+
+	    key.ptr = (PTR) keys[k];
+	    v = array_find(sp->A, &key, NO_CREATE);
+	    b = array_find(sp->base_A, &key, NO_CREATE);
+	    if (b == 0 || !same_value(v, b))
+		put_change(n, keys[k], v, b);
+	    free_STRING(keys[k]);
+	}
+	zfree(keys, size * sizeof(STRING *));
+    }
+
+    if (sp->base_A->size != 0) {
+	keys = array_loop_vector(sp->base_A, &size);
+	for (k = 0; k < size; ++k) {
+	    key.ptr = (PTR) keys[k];
+	    if (array_find(sp->A, &key, NO_CREATE) == 0) {
+		put_bytes(&op, 1);
+		put_bytes(&n, sizeof(n));
+		put_string(keys[k]);
+	    }
+	    free_STRING(keys[k]);
+	}
+	zfree(keys, size * sizeof(STRING *));
+    }
+}
+
+/*
+ * Called by a worker at the end of its piece of the input: send the
+ * changes to the parent, then the number of records and the last one.
+ */
+void
+parallel_finish(void)
+{
+    unsigned n;
+    char op = OP_END;
+    unsigned records = rt_nr - worker_nr;
+    CELL last;
+
+    for (n = 0; n < num_shared; ++n) {
+	SHARED *sp = &shared_list[n];
+
+	/* nothing reads it after the main rules */
+	if (sp->how == R_DEFAULT)
+	    continue;
+	if (sp->A != 0)
+	    put_array_changes(n);
+	else if (!same_value(sp->cp, &sp->base))
+	    put_change(n, (STRING *) 0, sp->cp, &sp->base);
+    }
+
+    put_bytes(&op, 1);
+    put_bytes(&records, sizeof(records));
+    cellcpy(&last, field);
+    if (last.type < C_STRING)
+	cast1_to_s(&last);
+    put_string(string(&last));
+    cell_destroy(&last);
+
+    if (fclose(to_parent) != 0) {
+	errmsg(errno, "-W parallel: cannot write results");
+	_exit(2);
+    }
+    _exit(0);
+}
+
+/*---------- the parent's side of the pipe ----------*/
+
+typedef struct {
+    int pid;
+    FILE *from;
+    size_t lo, hi;		/* offsets of this piece of the file */
+} WORKER;
+
+static WORKER *worker_list;
+static int worker_now;		/* the worker being read */
+
+static void
+get_bytes(void *data, size_t len)
+{
+    if (len != 0 && fread(data, 1, len, worker_list[worker_now].from) != len) {
+	errmsg(0, "-W parallel: worker %d failed", worker_now + 1);
+	mawk_exit(2);
+    }
+}
+
+static STRING *
+get_string(void)
+{
+    size_t len;
+    STRING *sval;
+
+    get_bytes(&len, sizeof(len));
+    sval = new_STRING0(len);
+    get_bytes(sval->str, len);
+    return sval;
+}
+
+static double
+get_double(void)
+{
+    double d;
+
+    get_bytes(&d, sizeof(d));
+    return d;
+}
+
+static void
+get_value(CELL * cp)
+{
+    char type;
+
+    get_bytes(&type, 1);
+    cp->type = type;
+    if (type == C_DOUBLE || type == C_STRNUM)
+	cp->dval = get_double();
+    if (type >= C_STRING)
+	cp->ptr = (PTR) get_string();
+}
+
+/* merge the changes made by one worker, returning its number of records */
+static unsigned
+merge_changes(CELL * last)
+{
+    char op;
+    unsigned n;
+    unsigned records;
+    CELL key;
+    CELL *cp;
+    SHARED *sp;
+
+    for (;;) {
+	get_bytes(&op, 1);
+	if (op == OP_END)
+	    break;
+	get_bytes(&n, sizeof(n));
+	if (n >= num_shared)
+	    bozo("parallel merge");
+	sp = &shared_list[n];
+
+	if (sp->A != 0) {
+	    key.type = C_STRING;
+	    key.ptr = (PTR) get_string();
+	    if (op == OP_DELETE) {
+		array_delete(sp->A, &key);
+		cell_destroy(&key);
+		continue;
+	    }
+	    cp = array_find(sp->A, &key, CREATE);
+	    cell_destroy(&key);
+	} else {
+	    cp = sp->cp;
+	}
+
+	switch (op) {
+	case OP_CREATE:
+	    break;
+	case OP_SUM:
+	    if (cp->type != C_DOUBLE)
+		cast1_to_d(cp);
+	    cp->dval += get_double();
+	    break;
+	case OP_MIN:
+	case OP_MAX:
+	    {
+		double d = get_double();
+
+		if (cp->type == C_NOINIT
+		    || (op == OP_MIN ? d < num_value(cp) : d > num_value(cp))) {
+		    cell_destroy(cp);
+		    cp->type = C_DOUBLE;
+		    cp->dval = d;
+		}
+	    }
+	    break;
+	case OP_CONCAT:
+	    {
+		STRING *suffix = get_string();
+		STRING *sval;
+
+		if (cp->type < C_STRING)
+		    cast1_to_s(cp);
+		sval = new_STRING0(string(cp)->len + suffix->len);
+		memcpy(sval->str, string(cp)->str, string(cp)->len);
+		memcpy(sval->str + string(cp)->len, suffix->str, suffix->len);
+		free_STRING(suffix);
+		cell_destroy(cp);
+		cp->type = C_STRING;
+		cp->ptr = (PTR) sval;
+	    }
+	    break;
+	case OP_LAST:
+	    cell_destroy(cp);
+	    get_value(cp);
+	    break;
+	default:
+	    bozo("parallel merge");
+	}
+    }
+
+    get_bytes(&records, sizeof(records));
+    key.type = C_STRING;
+    key.ptr = (PTR) get_string();
+    if (records != 0) {
+	cell_destroy(last);
+	cellcpy(last, &key);
+    }
+    cell_destroy(&key);
+    return records;
+}
+
+static void
+start_workers(int count)
+{
+    int k, j;
+    int fds[2];
+    unsigned n;
+
+    /* the workers inherit the snapshot of each global */
+    for (n = 0; n < num_shared; ++n) {
+	SHARED *sp = &shared_list[n];
+
+	if (sp->A != 0)
+	    sp->base_A = copy_array(sp->A);
+	else
+	    cellcpy(&sp->base, sp->cp);
+    }
+
+    /* else pending output would be written by each worker */
+    flush_all_output();
+    fflush(stdout);
+    fflush(stderr);
+
+    for (k = 0; k < count; ++k) {
+	WORKER *wp = &worker_list[k];
+
+	if (pipe(fds) == -1 || (wp->pid = fork()) == -1) {
+	    errmsg(errno, "-W parallel: cannot start worker");
+	    mawk_exit(2);
+	}
+	if (wp->pid == 0) {
+	    close(fds[0]);
+	    for (j = 0; j < k; ++j)
+		fclose(worker_list[j].from);
+	    parallel_worker = 1;
+	    worker_nr = rt_nr;
+	    if ((to_parent = fdopen(fds[1], "w")) == 0) {
+		errmsg(errno, "-W parallel");
+		_exit(2);
+	    }
+	    set_fin_range(main_fin, wp->lo, wp->hi);
+	    return;
+	}
+	close(fds[1]);
+	if ((wp->from = fdopen(fds[0], "r")) == 0) {
+	    errmsg(errno, "-W parallel");
+	    mawk_exit(2);
+	}
+    }
+}
+
+/*
+ * Called instead of open_main() if -W parallel is set.  In the parent this
+ * returns with all of the input read, and the main input at its end.  In a
+ * worker it returns with the main input limited to the worker's piece.
+ */
+void
+parallel_main(void)
+{
+    const char *why;
+    size_t size, lo, hi;
+    int count = 0;
+    int k;
+    unsigned records = 0;
+    CELL last;
+
+    if ((why = scan_program()) == 0 && !one_input_file())
+	why = "input is not a single file";
+
+    open_main();
+
+    if (why == 0) {
+	if (!(main_fin->flags & MMAP_FLAG))
+	    why = (fin_mmap
+		   ? "input is not a regular file"
+		   : "input is not mapped (-W mmap=0)");
+	else if (!rs_splits_anywhere())
+	    why = "RS is not a single character or simple string";
+    }
+    if (why != 0) {
+	errmsg(0, "-W parallel ignored: %s", why);
+	return;
+    }
+
+    /* cut the file at the first RS after each Nth of it */
+    size = main_fin->mapped;
+    worker_list = (WORKER *) zmalloc((size_t) parallel_jobs * sizeof(WORKER));
+    for (k = 1, lo = 0; k <= parallel_jobs && lo < size; ++k, lo = hi) {
+	if (k == parallel_jobs) {
+	    hi = size;
+	} else {
+	    hi = (size / (size_t) parallel_jobs) * (size_t) k;
+	    if (hi < lo)
+		hi = lo;
+	    hi = next_boundary(main_fin->buff, size, hi);
+	}
+	if (hi > lo) {
+	    worker_list[count].lo = lo;
+	    worker_list[count].hi = hi;
+	    ++count;
+	}
+    }
+    TRACE(("parallel: %d pieces of %lu bytes\n", count, (unsigned long) size));
+
+    start_workers(count);
+    if (parallel_worker)
+	return;
+
+    last.type = C_NOINIT;
+    for (worker_now = 0; worker_now < count; ++worker_now) {
+	WORKER *wp = &worker_list[worker_now];
+	int status;
+
+	records += merge_changes(&last);
+	fclose(wp->from);
+	if ((status = wait_for(wp->pid)) != 0)
+	    mawk_exit(status);
+    }
+    zfree(worker_list, (size_t) parallel_jobs * sizeof(WORKER));
+
+    /* as if the parent had read every record */
+    if (TEST2(NR) != TWO_DOUBLES)
+	cast2_to_d(NR);
+    NR->dval += (double) records;
+    FNR->dval += (double) records;
+    rt_nr += records;
+    rt_fnr += records;
+    if (last.type != C_NOINIT) {
+	set_field0(string(&last)->str, string(&last)->len);
+	cell_destroy(&last);
+    }
+    set_fin_range(main_fin, size, size);
+}
+
+#endif /* USE_PARALLEL */
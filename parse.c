@@ -202,11 +202,11 @@ static const short yylhs[] = {                           -1,
     4,    4,   18,   18,   19,   19,   53,   53,   13,   13,
    10,   15,   15,    4,    4,   20,    4,   11,   11,   11,
    11,   11,   15,   13,   13,   13,   13,   13,   13,   13,
-   15,   22,   54,   54,   15,   23,    4,    4,   21,   21,
-   15,   15,   15,   15,   15,   55,   12,   12,    9,    9,
-   15,   28,   28,   24,   24,   38,   29,   30,   30,   34,
-   34,   35,   35,   39,   15,   31,   31,   32,   32,   32,
-   33,   33,
+   15,   22,   54,   54,   15,   15,   23,    4,    4,   21,
+   21,   15,   15,   15,   15,   15,   55,   12,   12,    9,
+    9,   15,   28,   28,   24,   24,   38,   29,   30,   30,
+   34,   34,   35,   35,   39,   15,   31,   31,   32,   32,
+   32,   33,   33,
 };
 static const short yylen[] = {                            2,
     1,    2,    1,    1,    2,    1,    0,    3,    0,    3,
@@ -222,546 +222,537 @@ static const short yylen[] = {                            2,
     2,    4,    3,    4,    1,    2,    1,    2,    3,    5,
     5,    5,    6,    7,    3,    6,    2,    1,    2,    6,
     2,    3,    1,    3,    3,    3,    3,    3,    3,    3,
-    2,    5,    1,    3,    6,    1,    2,    3,    2,    3,
-    1,    2,    2,    3,    4,    1,    1,    1,    2,    3,
-    6,    1,    1,    1,    3,    2,    4,    2,    2,    0,
-    1,    1,    3,    1,    3,    2,    2,    1,    3,    3,
-    2,    2,
+    2,    5,    1,    3,    6,    8,    1,    2,    3,    2,
+    3,    1,    2,    2,    3,    4,    1,    1,    1,    2,
+    3,    6,    1,    1,    1,    3,    2,    4,    2,    2,
+    0,    1,    1,    3,    1,    3,    2,    2,    1,    3,
+    3,    2,    2,
 };
 static const short yydefred[] = {                         0,
-  164,    0,  146,    0,    0,    0,    0,    0,  118,    0,
-   57,   58,   61,    0,   83,   83,   82,    0,    0,  152,
-  153,    7,    9,    0,    0,    6,   71,    0,    0,    0,
+  165,    0,  147,    0,    0,    0,    0,    0,  118,    0,
+   57,   58,   61,    0,   83,   83,   82,    0,    0,  153,
+  154,    7,    9,    0,    0,    6,   71,    0,    0,    0,
     0,    0,    0,    0,    0,    0,    0,    1,    3,    4,
     0,    0,    0,   31,   32,   85,   86,   98,    0,    0,
     0,    0,    0,    0,    0,    0,    0,    0,   22,    0,
    20,    0,    0,    0,    0,    0,   28,   83,   24,    0,
     0,    0,    0,    0,    0,    0,    0,    0,   73,   75,
     0,  121,    0,    0,    0,   72,    0,    0,    0,    0,
-    0,    0,    0,  158,  159,    2,    0,    0,    0,    0,
+    0,    0,    0,  159,  160,    2,    0,    0,    0,    0,
     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
     0,   74,   13,   52,   48,   50,    0,    0,    0,    0,
     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,  133,  131,    0,  156,    0,    5,
-  149,  147,  148,    0,   17,   25,    0,    0,   26,   27,
-    0,    0,    0,  137,   29,   30,    0,  139,    0,   16,
+    0,    0,    0,    0,  133,  131,    0,  157,    0,    5,
+  150,  148,  149,    0,   17,   25,    0,    0,   26,   27,
+    0,    0,    0,  138,   29,   30,    0,  140,    0,   16,
    21,   23,  101,    0,  105,    0,    0,  117,    0,    0,
     0,    0,    0,    0,    0,    0,    0,  122,    0,   60,
-    0,    0,  165,    0,    0,    0,    0,    8,   10,    0,
+    0,    0,  166,    0,    0,    0,    0,    8,   10,    0,
     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
     0,    0,    0,    0,    0,    0,    0,  109,    0,   41,
    42,   43,   44,   45,   46,   18,   12,   19,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,  162,    0,
-    0,  150,    0,  103,    0,    0,    0,    0,  115,  138,
-  140,   96,    0,  106,  107,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  163,    0,
+    0,  151,    0,  103,    0,    0,    0,    0,  115,  139,
+  141,   96,    0,  106,  107,    0,    0,    0,    0,    0,
    87,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-  166,    0,    0,  167,    0,    0,    0,    0,    0,    0,
-    0,  145,  134,    0,  157,    0,  100,    0,  104,   94,
+  167,    0,    0,  168,    0,    0,    0,    0,    0,    0,
+    0,  146,  134,    0,  158,    0,  100,    0,  104,   94,
     0,   97,  108,  102,   89,    0,    0,    0,    0,    0,
-    0,    0,    0,  110,    0,  170,  172,  169,  171,   81,
-  132,    0,    0,   53,    0,  163,    0,    0,    0,    0,
-   84,    0,    0,    0,  111,  120,  113,  135,   15,    0,
-    0,  154,  151,  116,    0,    0,    0,    0,  114,   99,
-  155,
+    0,    0,    0,  110,    0,  171,  173,  170,  172,   81,
+  132,    0,    0,   53,    0,  164,    0,    0,    0,    0,
+   84,    0,    0,    0,  111,  120,  113,    0,  135,   15,
+    0,    0,  155,  152,  116,    0,    0,    0,    0,    0,
+  114,   99,  136,  156,
 };
 static const short yydgoto[] = {                         25,
    59,  217,   60,   61,   87,  249,   83,   27,   28,   29,
    30,  144,   62,   32,   33,   63,   64,   65,  167,   66,
-   67,   34,  228,  323,  251,  252,   68,   35,   36,   37,
+   67,   34,  228,  324,  251,  252,   68,   35,   36,   37,
   183,  184,  264,  230,  231,   38,   39,   40,   41,   92,
-   93,  125,  204,  303,   69,  206,  207,  205,  320,  288,
+   93,  125,  204,  303,   69,  206,  207,  205,  321,  288,
   243,   70,  247,  136,   42,
 };
 static const short yysindex[] = {                       -73,
-    0,  206,    0, 2222, 2222, 2222,  -88, 2132,    0, 2252,
-    0,    0,    0, -286,    0,    0,    0, -279, -243,    0,
-    0,    0,    0, -291,  -73,    0,    0, 2222, 2510,  -69,
- 2511, 2222,  -27, -263, -145, -174, -125,    0,    0,    0,
- -174, -156, -191,    0,    0,    0,    0,    0, -123, -117,
- -231, -231, -114, -112, 1659, -231, -231, 1659,    0,   56,
-    0, 2478,  281,  281, 1750,  281,    0,    0,    0,  281,
- 2252, -286, -106, -203, -203, -203, -218,    0,    0,    0,
-    0,    0, -257, 2126, 2073,    0,  -53,  -82,  -77, 2252,
- 2252, -174, -174,    0,    0,    0,  -63, 2252, 2252, 2252,
- 2252, 2252, 2252, 2252, 2252, 2252, 2252, 2252, 2252, 2252,
- 2252,    0,    0,    0,    0,    0,  -62, 2252, 2252, 2252,
- 2252, 2252, 2252, 2252,   12,  -27, 2222, 2222, 2222, 2222,
- 2222,  -41, 2222, 2252,    0,    0, 2252,    0,  -58,    0,
-    0,    0,    0,  -36,    0,    0, 2252, 1780,    0,    0,
- 2252, -231, 2478,    0,    0,    0, 2478,    0, -231,    0,
-    0,    0,    0,  -49,    0,   53, 2162,    0, 2282,  -64,
- 2385,   -3,  -26,   24,   26, 2252,    5,    0, 2252,    0,
- 2252,  -10,    0, 2312, 2252, 2532, 2553,    0,    0, 2577,
- 2577, 2577, 2577, 2577, 2577, 2577, 2577, 2577, 2577, 2577,
- 2577, 2577, 2577, 2252, 2252, 2252, 2252,    0,  123,    0,
+    0,  202,    0, 2238, 2238, 2238, -156, 2148,    0, 2268,
+    0,    0,    0, -286,    0,    0,    0, -246, -243,    0,
+    0,    0,    0, -291,  -73,    0,    0, 2238, 2115,  -69,
+ 2542, 2238,   38, -257, -208, -174, -165,    0,    0,    0,
+ -174,  -23, -106,    0,    0,    0,    0,    0, -150, -146,
+ -177, -177, -123, -122, 1655, -177, -177, 1655,    0,   52,
+    0, 2494,  277,  277, 1746,  277,    0,    0,    0,  277,
+ 2268, -286, -111,  -78,  -78,  -78, -271,    0,    0,    0,
+    0,    0, -214, 2142, 2089,    0,  -71, -107,  -88, 2268,
+ 2268, -174, -174,    0,    0,    0,  -63, 2268, 2268, 2268,
+ 2268, 2268, 2268, 2268, 2268, 2268, 2268, 2268, 2268, 2268,
+ 2268,    0,    0,    0,    0,    0,  -82, 2268, 2268, 2268,
+ 2268, 2268, 2268, 2268,  -49,   38, 2238, 2238, 2238, 2238,
+ 2238,  -39, 2238, 2268,    0,    0, 2268,    0,  -52,    0,
+    0,    0,    0,  -28,    0,    0, 2268, 1776,    0,    0,
+ 2268, -177, 2494,    0,    0,    0, 2494,    0, -177,    0,
+    0,    0,    0,  -37,    0, 2506, 2178,    0, 2298,  -31,
+ 2401,   26,  -10,   33,   39, 2268,   19,    0, 2268,    0,
+ 2268,    3,    0, 2328, 2268, 2563, 2584,    0,    0, 2608,
+ 2608, 2608, 2608, 2608, 2608, 2608, 2608, 2608, 2608, 2608,
+ 2608, 2608, 2608, 2268, 2268, 2268, 2268,    0,  119,    0,
     0,    0,    0,    0,    0,    0,    0,    0, -101, -101,
- -203, -203, -203,  -88,  -63, 2397, 2577,   28,    0,    9,
-   44,    0, 2412,    0, -223, 2490, 2424,   60,    0,    0,
-    0,    0,  281,    0,    0, 2439,  281, 2192,   62, 2577,
-    0,   54,   25, 2252, 2252, 2252, 2577,   36, 2577, -128,
-    0, -147, 2100,    0,   48,   40, 2252, 2577, 2565, 2586,
- 2464,    0,    0, 2252,    0,   45,    0,   46,    0,    0,
- 2252,    0,    0,    0,    0, -235, 2252, -231, 2252, 2252,
- -124, -111,  -43,    0,   55,    0,    0,    0,    0,    0,
-    0,   61,   12,    0, 2127,    0,   77,  -14,    5, 2577,
-    0, 2577, 2451,   55,    0,    0,    0,    0,    0, 2252,
-  -88,    0,    0,    0, -231, -231, 2577,   79,    0,    0,
-    0,
+  -78,  -78,  -78, -156,  -63, 2413, 2608,   36,    0,    4,
+   51,    0, 2428,    0, -276, 2521, 2440,   40,    0,    0,
+    0,    0,  277,    0,    0, 2455,  277, 2208,   53, 2608,
+    0,   55,   16, 2268, 2268, 2268, 2608,   -2, 2608, -124,
+    0, -231, 2116,    0,   29,   12, 2268, 2608, 2596, 2617,
+  271,    0,    0, 2268,    0,   27,    0,   31,    0,    0,
+ 2268,    0,    0,    0,    0, -184, 2268, -177, 2268, 2268,
+  -43,  -26,  -14,    0,   44,    0,    0,    0,    0,    0,
+    0, -171,  -49,    0, 2143,    0,   30,   -5,   19, 2608,
+    0, 2608, 2467,   44,    0,    0,    0,   37,    0,    0,
+ 2268, -156,    0,    0,    0, -177, -177,   42, 2608,   45,
+    0,    0,    0,    0,
 };
 static const short yyrindex[] = {                         0,
     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,  527,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0, 1513,
-   47,   20, 1571,    0,    0,    0,    0,    0,    0,    0,
-    0, 1339,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  523,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0, 1509,
+  -15, 1934, 1567,    0,    0,    0,    0,    0,    0,    0,
+    0, 1335,    0,    0,    0,    0,    0,    0,    0,    0,
     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,  469,  585,  817,  875,  933,    0,  353,    0,    0,
-  411,    0,    0, 1880,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,  991,    0,    0,    0,
+    0,  465,  581,  813,  871,  929,    0,  349,    0,    0,
+  407,    0,    0, 1876,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  987,    0,    0,    0,
     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0, 1629,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,   86,    0,
-    0,    0,    0,  643,    0,    0,    0,    0,    0,    0,
-    0,   95,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,  131,    0,    0,    0,    0, -102,    0,
+    0,    0,    0,    0,    0, 1625,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,   57,    0,
+    0,    0,    0,  639,    0,    0,    0,    0,    0,    0,
+    0,   60,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  127,    0,    0,    0,    0, -191,    0,
     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0, 2342,    0,    0,   87,    0,    0,    0,    0, -212,
- 1938, 1946, 1958, 1966, 1978, 1986, 1998, 2006, 2018, 2026,
- 2038, 2046, 2058,    0,    0,    0,    0,    0,  136,    0,
-    0,    0,    0,    0,    0,    0,    0,    0, 1397, 1455,
- 1049, 1107, 1165, 1281,  701,    0, -214,    0,    0,    0,
-   92,    0,    0,    0, 1716,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    7, -241,
-    0, -216,    0,    0,    0,    0, -169,    0, -168,    0,
-    0, 1834,    0,    0,    0,    0,    0,   80,    0,  286,
-  211,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0, 2358,    0,    0,   73,    0,    0,    0,    0, -212,
+   34,  282, 1962, 1974, 1982, 1994, 2002, 2014, 2022, 2034,
+ 2042, 2054, 2062,    0,    0,    0,    0,    0,  132,    0,
+    0,    0,    0,    0,    0,    0,    0,    0, 1393, 1451,
+ 1045, 1103, 1161, 1277,  697,    0, -169,    0,    0,    0,
+   75,    0,    0,    0, 1712,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,   14, -241,
+    0, -216,    0,    0,    0,    0, -168,    0, -126,    0,
+    0, 1830,    0,    0,    0,    0,    0,    2,    0,    5,
+  207,    0,    0,    0,    0,    0,    0,    0,    0,    0,
     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0, 1223,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,  -21,   18,
-    0,  -93,    0,  759,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0, 2066,    0,    0,    0,
-    0,
+    0,    0,    0,    0, 1219,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0, -102,   25,
+    0,  -93,    0,  755,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0, 2074,    0,
+    0,    0,    0,    0,
 };
 static const short yygindex[] = {                         0,
-   21,   96,    0,  -50,   17,    0,  134,    0,    0,   -7,
-   -1, -190,    1,    0,   32,    0,    0,    0,    0,    0,
-    0,    0,  142,    0,  213, -139,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,  391,    0,    0,    0,    0,
+   21,   35,    0,  -50,   17,    0,   98,    0,    0,   -7,
+   -1, -185,    1,    0,   32,    0,    0,    0,    0,    0,
+    0,    0,   87,    0,  193, -139,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  359,    0,    0,    0,    0,
     0,    0,    0,    0,   22,    0,    0,    0,    0,    0,
     0,    0,    0,    0,    0,
 };
-#define YYTABLESIZE 2871
+#define YYTABLESIZE 2902
 static const short yytable[] = {                         79,
-   31,  134,   73,   73,   73,   80,   73,  176,   84,  161,
+   31,  278,   73,   73,   73,   80,   73,  134,   84,  161,
    85,   86,  163,  164,   94,  168,   95,   79,   79,  170,
-   26,   90,   79,   79,   79,   31,   73,   44,   45,  176,
-   73,   88,   89,  272,  142,   74,   75,   76,  135,   82,
-  143,  260,   78,   78,  177,   26,   34,   34,   34,   78,
-  136,   34,   34,   34,  278,  153,  138,   91,  157,   97,
-   79,  140,   34,  126,  146,  166,  309,   44,   45,   84,
-  145,  171,  149,  150,   86,  173,  154,  155,  156,  158,
-    8,    9,   77,  162,  169,   78,    2,  136,  172,   34,
-  186,  187,  132,  133,  174,   91,   90,  175,  190,  191,
+   26,   86,   79,   79,   79,   31,   73,    8,    9,   77,
+   73,   88,   89,  296,  142,   74,   75,   76,  272,   82,
+  143,  260,   78,   78,  135,   26,   34,   34,   34,   78,
+  176,   34,   34,   34,   90,  153,  138,   91,  157,   97,
+   79,  140,   34,  126,  146,  166,   86,   77,   77,   84,
+  297,  171,  149,  150,   77,  173,  154,  155,  156,  158,
+  176,   44,   45,  162,  169,   78,    2,  177,  172,   34,
+  186,  187,  137,  318,  174,  137,   91,  175,  190,  191,
   192,  193,  194,  195,  196,  197,  198,  199,  200,  201,
-  202,  203,  188,  189,  291,  292,  293,  296,  209,  210,
+  202,  203,  188,  189,  291,  292,  293,  309,  209,  210,
   211,  212,  213,  214,  215,   73,   73,   73,   73,   73,
-  328,   73,   91,   90,  226,  295,  289,  227,  141,  314,
+  319,   73,  137,   91,  226,  139,  330,  227,   90,  295,
   289,  308,    8,    9,   77,  216,  218,  233,  236,   78,
-   86,  237,  315,  289,  297,  137,   77,   77,  219,  220,
-  221,  222,  223,   77,  225,   80,   80,  246,  238,  250,
-   80,   80,   80,  239,  240,  139,  257,  147,  241,  259,
-  146,  250,    1,  148,  263,  250,  151,    2,  129,  130,
-  131,  112,  282,  152,  132,  133,  284,  105,  106,  107,
-  108,  109,  110,  111,  268,  269,  270,  271,   80,  181,
-    8,    9,   77,    3,    4,    5,  142,   78,  182,    6,
-  316,  289,  143,  185,    7,    8,    9,   10,  112,   11,
-   12,   13,   14,  133,   15,   16,   17,   88,   88,   18,
-   19,   20,   21,  208,   88,  224,   84,  229,   85,  325,
-  289,   22,   23,  253,  250,  250,  250,   24,  232,  254,
-  127,  128,  129,  130,  131,   92,   92,  227,  132,  133,
-   44,   45,    2,  242,  305,  178,   93,   93,   33,   33,
-   33,  250,  258,   33,   33,   33,  255,  310,  256,  312,
-  313,  261,  274,   33,   33,   33,   33,   33,   33,   33,
-   33,   33,   33,   33,   33,   11,   11,   11,  276,  311,
-  275,  159,  244,  142,   44,   45,    2,  160,  289,  143,
-  327,   33,  281,  216,  218,  290,  114,  287,  115,  116,
-  117,  118,  119,  120,  121,  122,  123,  124,   14,   14,
-   14,  294,    3,    4,    5,  301,  329,  330,    6,  300,
-  306,  307,  317,    7,    8,    9,   10,   83,   11,   12,
-   13,   14,  318,   15,   16,   17,   46,   47,   18,   19,
-   20,   21,   48,   49,   50,   51,   52,   53,  324,   54,
-  331,  286,   55,   56,   57,   58,   95,  160,   77,   95,
-   95,   95,   95,  161,   47,   47,   47,  265,  319,   47,
-   47,   47,  119,  120,  121,  122,  123,  124,  302,   47,
-   47,   47,   47,   47,   47,   96,    0,   95,   95,   95,
-    0,    0,    0,   95,    0,    0,    0,    0,   95,   95,
-   95,   95,    0,   95,   95,   95,   95,   47,   95,   95,
-   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-   95,   95,   95,    0,   95,    0,    0,   95,   95,   95,
-   95,   43,    0,    0,   44,   45,    2,    0,    0,   51,
-   51,   51,    0,    0,   51,   51,   51,    0,    0,    0,
-    0,    0,    0,    0,   51,   51,   51,   51,    0,    0,
-    0,    0,    3,    4,    5,    0,    0,    0,    6,    0,
-    0,    0,    0,    7,    8,    9,   10,    0,   11,   12,
-   13,   14,   51,   15,   16,   17,   46,   47,   18,   19,
-   20,   21,   48,   49,   50,   51,   52,   53,    0,   54,
-    0,    0,   55,   56,   57,   58,  159,    0,    0,   44,
-   45,    2,    0,    0,   49,   49,   49,    0,    0,   49,
-   49,   49,    0,    0,    0,    0,    0,    0,    0,   49,
-   49,   49,    0,    0,    0,    0,    0,    3,    4,    5,
-    0,    0,    0,    6,    0,    0,    0,    0,    7,    8,
-    9,   10,    0,   11,   12,   13,   14,   49,   15,   16,
-   17,   46,   47,   18,   19,   20,   21,   48,   49,   50,
-   51,   52,   53,    0,   54,    0,    0,   55,   56,   57,
-   58,   76,   76,   76,    0,   83,   76,   76,   76,   76,
+  147,  237,   44,   45,  148,  145,   88,   88,  219,  220,
+  221,  222,  223,   88,  225,   80,   80,  246,  238,  250,
+   80,   80,   80,  239,  240,   90,  257,  151,  241,  259,
+  146,  250,    1,  152,  263,  250,  112,    2,  129,  130,
+  131,  181,  282,  182,  132,  133,  284,  105,  106,  107,
+  108,  109,  110,  111,  268,  269,  270,  271,   80,   44,
+   45,    2,  185,    3,    4,    5,  142,  132,  133,    6,
+  314,  289,  143,  208,    7,    8,    9,   10,  112,   11,
+   12,   13,   14,  133,   15,   16,   17,  315,  289,   18,
+   19,   20,   21,   11,   11,   11,   84,  224,   85,  316,
+  289,   22,   23,  229,  250,  250,  250,   24,  326,  289,
+   14,   14,   14,   49,   49,   49,  232,  227,   49,   49,
+   49,  141,   92,   92,  305,    8,    9,   77,   49,   49,
+   49,  250,   78,   93,   93,  242,  253,  310,  254,  312,
+  313,  178,   35,   35,   35,  255,  258,   35,   35,   35,
+  274,  256,  281,  294,  261,  275,   49,  159,   35,  311,
+   44,   45,    2,  160,  142,  276,  290,  301,  287,  289,
+  143,  329,   83,  216,  218,  127,  128,  129,  130,  131,
+  300,  325,  306,  132,  133,   35,  307,  320,    3,    4,
+    5,  317,  328,  333,    6,  286,  334,  331,  332,    7,
+    8,    9,   10,  302,   11,   12,   13,   14,  161,   15,
+   16,   17,   46,   47,   18,   19,   20,   21,   48,   49,
+   50,   51,   52,   53,   77,   54,  162,  265,   55,   56,
+   57,   58,   95,   96,    0,   95,   95,   95,   95,    0,
+   47,   47,   47,    0,    0,   47,   47,   47,  119,  120,
+  121,  122,  123,  124,    0,   47,   47,   47,   47,   47,
+   47,    0,    0,   95,   95,   95,    0,    0,    0,   95,
+    0,    0,    0,    0,   95,   95,   95,   95,    0,   95,
+   95,   95,   95,   47,   95,   95,   95,   95,   95,   95,
+   95,   95,   95,   95,   95,   95,   95,   95,   95,    0,
+   95,    0,    0,   95,   95,   95,   95,   43,    0,    0,
+   44,   45,    2,    0,    0,   51,   51,   51,    0,    0,
+   51,   51,   51,    0,    0,    0,    0,    0,    0,    0,
+   51,   51,   51,   51,    0,    0,    0,    0,    3,    4,
+    5,    0,    0,    0,    6,    0,    0,    0,    0,    7,
+    8,    9,   10,    0,   11,   12,   13,   14,   51,   15,
+   16,   17,   46,   47,   18,   19,   20,   21,   48,   49,
+   50,   51,   52,   53,    0,   54,    0,    0,   55,   56,
+   57,   58,  159,    0,    0,   44,   45,    2,    0,    0,
+   36,   36,   36,    0,    0,   36,   36,   36,  117,  118,
+  119,  120,  121,  122,  123,  124,   36,    0,    0,    0,
+    0,    0,    0,    3,    4,    5,    0,    0,    0,    6,
+    0,    0,    0,    0,    7,    8,    9,   10,    0,   11,
+   12,   13,   14,   36,   15,   16,   17,   46,   47,   18,
+   19,   20,   21,   48,   49,   50,   51,   52,   53,    0,
+   54,    0,    0,   55,   56,   57,   58,   76,   76,   76,
+    0,   83,   76,   76,   76,   76,   76,   76,   76,   76,
    76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
-   76,   76,   76,   76,   76,   76,   76,   76,    0,   76,
-   76,   76,   76,   76,   76,   76,    0,   76,   76,   76,
-   76,   76,   76,   76,   76,   76,   76,   76,   76,    0,
-   76,   76,   76,    0,    0,   76,   76,   76,   76,  119,
-  119,  119,    0,   83,  119,  119,  119,  119,  119,  119,
+   76,   76,   76,   76,    0,   76,   76,   76,   76,   76,
+   76,   76,    0,   76,   76,   76,   76,   76,   76,   76,
+   76,   76,   76,   76,   76,    0,   76,   76,   76,    0,
+    0,   76,   76,   76,   76,  119,  119,  119,    0,   83,
+  119,  119,  119,  119,  119,  119,  119,  119,  119,  119,
   119,  119,  119,  119,  119,  119,  119,  119,  119,  119,
-  119,  119,  119,  119,  119,  119,    0,  119,  119,  119,
-  119,  119,  119,  119,    0,  119,  119,  119,  119,  119,
-  119,  119,  119,  119,  119,  119,  119,    0,  119,  119,
-  119,    0,    0,  119,  119,  119,  119,   59,   59,   59,
-    0,   83,   59,   59,   59,   59,   59,   59,   59,   59,
+  119,  119,    0,  119,  119,  119,  119,  119,  119,  119,
+    0,  119,  119,  119,  119,  119,  119,  119,  119,  119,
+  119,  119,  119,    0,  119,  119,  119,    0,    0,  119,
+  119,  119,  119,   59,   59,   59,    0,   83,   59,   59,
    59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
-   59,   59,   59,   59,    0,   59,   59,   59,   59,   59,
-   59,   59,    0,   59,   59,   59,    0,   59,   59,   59,
-   59,   59,   59,   59,   59,    0,   59,   59,   59,    0,
-    0,   59,   59,   59,   59,   59,   59,   59,    0,   83,
-   59,   59,   59,   76,   76,   76,   76,   76,   76,   76,
    59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+    0,   59,   59,   59,   59,   59,   59,   59,    0,   59,
    59,   59,    0,   59,   59,   59,   59,   59,   59,   59,
-    0,    0,   59,   59,    0,   59,   59,   59,   59,   59,
-   59,   59,   59,    0,   59,   59,   59,    0,    0,   59,
-   59,   59,   59,  123,  123,  123,    0,    0,  123,  123,
+   59,    0,   59,   59,   59,    0,    0,   59,   59,   59,
+   59,   59,   59,   59,    0,   83,   59,   59,   59,   76,
+   76,   76,   76,   76,   76,   76,   59,   59,   59,   59,
+   59,   59,   59,   59,   59,   59,   59,   59,    0,   59,
+   59,   59,   59,   59,   59,   59,    0,    0,   59,   59,
+    0,   59,   59,   59,   59,   59,   59,   59,   59,    0,
+   59,   59,   59,    0,    0,   59,   59,   59,   59,  123,
+  123,  123,    0,    0,  123,  123,  123,  123,  123,  123,
   123,  123,  123,  123,  123,  123,  123,  123,  123,  123,
-  123,  123,  123,  123,  123,  123,  123,  123,  123,  123,
-    0,  123,  123,  123,  123,  123,  123,  123,    0,  123,
-  123,  123,    0,  123,  123,  123,  123,  123,  123,  123,
-  123,    0,  123,  123,  123,    0,    0,  123,  123,  123,
-  123,  142,  142,  142,    0,    0,  142,  142,  142,  142,
-  142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
-  142,  142,  142,  142,  142,  142,  142,  142,    0,  142,
-  142,  142,  142,  142,  142,  142,    0,    0,  142,  142,
-  142,  142,  142,  142,  142,  142,  142,  142,  142,    0,
-  142,  142,  142,    0,    0,  142,  142,  142,  142,   67,
-   67,   67,    0,    0,   67,   67,   67,   67,   67,   67,
+  123,  123,  123,  123,  123,  123,    0,  123,  123,  123,
+  123,  123,  123,  123,    0,  123,  123,  123,    0,  123,
+  123,  123,  123,  123,  123,  123,  123,    0,  123,  123,
+  123,    0,    0,  123,  123,  123,  123,  143,  143,  143,
+    0,    0,  143,  143,  143,  143,  143,  143,  143,  143,
+  143,  143,  143,  143,  143,  143,  143,  143,  143,  143,
+  143,  143,  143,  143,    0,  143,  143,  143,  143,  143,
+  143,  143,    0,    0,  143,  143,  143,  143,  143,  143,
+  143,  143,  143,  143,  143,    0,  143,  143,  143,    0,
+    0,  143,  143,  143,  143,   67,   67,   67,    0,    0,
+   67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
    67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
-   67,   67,   67,   67,   67,   67,    0,   67,   67,   67,
-   67,   67,   67,   67,    0,   67,   67,    0,   67,   67,
-   67,   67,   67,   67,   67,   67,   67,    0,   67,   67,
-   67,    0,    0,   67,   67,   67,   67,  112,  112,  112,
-    0,    0,  112,  112,  112,  112,  112,  112,  112,  112,
+   67,   67,    0,   67,   67,   67,   67,   67,   67,   67,
+    0,   67,   67,    0,   67,   67,   67,   67,   67,   67,
+   67,   67,   67,    0,   67,   67,   67,    0,    0,   67,
+   67,   67,   67,  112,  112,  112,    0,    0,  112,  112,
   112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
-  112,  112,  112,  112,    0,  112,  112,  112,  112,  112,
-  112,  112,    0,  112,  112,  112,    0,  112,  112,  112,
-  112,  112,  112,  112,  112,    0,  112,  112,  112,    0,
-    0,  112,  112,  112,  112,   69,   69,   69,    0,    0,
-   69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+  112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+    0,  112,  112,  112,  112,  112,  112,  112,    0,  112,
+  112,  112,    0,  112,  112,  112,  112,  112,  112,  112,
+  112,    0,  112,  112,  112,    0,    0,  112,  112,  112,
+  112,   69,   69,   69,    0,    0,   69,   69,   69,   69,
    69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
-   69,   69,    0,   69,   69,   69,   69,   69,   69,   69,
-    0,   69,    0,    0,   69,   69,   69,   69,   69,   69,
-   69,   69,   69,    0,   69,   69,   69,    0,    0,   69,
-   69,   69,   69,   70,   70,   70,    0,    0,   70,   70,
+   69,   69,   69,   69,   69,   69,   69,   69,    0,   69,
+   69,   69,   69,   69,   69,   69,    0,   69,    0,    0,
+   69,   69,   69,   69,   69,   69,   69,   69,   69,    0,
+   69,   69,   69,    0,    0,   69,   69,   69,   69,   70,
+   70,   70,    0,    0,   70,   70,   70,   70,   70,   70,
    70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
-   70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
-    0,   70,   70,   70,   70,   70,   70,   70,    0,   70,
-    0,    0,   70,   70,   70,   70,   70,   70,   70,   70,
-   70,    0,   70,   70,   70,    0,    0,   70,   70,   70,
-   70,   68,   68,   68,    0,    0,   68,   68,   68,   68,
+   70,   70,   70,   70,   70,   70,    0,   70,   70,   70,
+   70,   70,   70,   70,    0,   70,    0,    0,   70,   70,
+   70,   70,   70,   70,   70,   70,   70,    0,   70,   70,
+   70,    0,    0,   70,   70,   70,   70,   68,   68,   68,
+    0,    0,   68,   68,   68,   68,   68,   68,   68,   68,
    68,   68,   68,   68,   68,   68,   68,   68,   68,   68,
-   68,   68,   68,   68,   68,   68,   68,   68,    0,   68,
-   68,   68,   68,   68,   68,   68,    0,   68,    0,    0,
-   68,   68,   68,   68,   68,   68,   68,   68,   68,    0,
-   68,   68,   68,    0,    0,   68,   68,   68,   68,  143,
-  143,  143,    0,    0,  143,  143,  143,  143,  143,  143,
-  143,  143,  143,  143,  143,  143,  143,  143,  143,  143,
-  143,  143,  143,  143,  143,  143,    0,  143,  143,  143,
-  143,  143,  143,  143,    0,  143,    0,    0,  143,  143,
-  143,  143,  143,  143,  143,  143,  143,    0,  143,  143,
-  143,    0,    0,  143,  143,  143,  143,   64,   64,   64,
-    0,    0,   64,   64,   64,   64,   64,   64,   64,   64,
+   68,   68,   68,   68,    0,   68,   68,   68,   68,   68,
+   68,   68,    0,   68,    0,    0,   68,   68,   68,   68,
+   68,   68,   68,   68,   68,    0,   68,   68,   68,    0,
+    0,   68,   68,   68,   68,  144,  144,  144,    0,    0,
+  144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
+  144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
+  144,  144,    0,  144,  144,  144,  144,  144,  144,  144,
+    0,  144,    0,    0,  144,  144,  144,  144,  144,  144,
+  144,  144,  144,    0,  144,  144,  144,    0,    0,  144,
+  144,  144,  144,   64,   64,   64,    0,    0,   64,   64,
    64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
-   64,   64,   64,   64,    0,   64,   64,   64,   64,   64,
-   64,   64,    0,   64,    0,    0,   64,   64,   64,   64,
-   64,   64,   64,   64,   64,    0,   64,   64,   64,    0,
-    0,   64,   64,   64,   64,   65,   65,   65,    0,    0,
-   65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+   64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+    0,   64,   64,   64,   64,   64,   64,   64,    0,   64,
+    0,    0,   64,   64,   64,   64,   64,   64,   64,   64,
+   64,    0,   64,   64,   64,    0,    0,   64,   64,   64,
+   64,   65,   65,   65,    0,    0,   65,   65,   65,   65,
    65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
-   65,   65,    0,   65,   65,   65,   65,   65,   65,   65,
-    0,   65,    0,    0,   65,   65,   65,   65,   65,   65,
-   65,   65,   65,    0,   65,   65,   65,    0,    0,   65,
-   65,   65,   65,   66,   66,   66,    0,    0,   66,   66,
+   65,   65,   65,   65,   65,   65,   65,   65,    0,   65,
+   65,   65,   65,   65,   65,   65,    0,   65,    0,    0,
+   65,   65,   65,   65,   65,   65,   65,   65,   65,    0,
+   65,   65,   65,    0,    0,   65,   65,   65,   65,   66,
+   66,   66,    0,    0,   66,   66,   66,   66,   66,   66,
    66,   66,   66,   66,   66,   66,   66,   66,   66,   66,
-   66,   66,   66,   66,   66,   66,   66,   66,   66,   66,
-    0,   66,   66,   66,   66,   66,   66,   66,    0,   66,
-    0,    0,   66,   66,   66,   66,   66,   66,   66,   66,
-   66,    0,   66,   66,   66,    0,    0,   66,   66,   66,
-   66,  112,  112,  112,    0,    0,  112,  112,  112,  111,
-  111,  111,  111,  111,  111,  111,  112,  112,  112,  112,
-  112,  112,  112,  112,  112,  112,  112,  112,    0,  112,
-  112,  112,  112,  112,  112,  112,    0,    0,  112,  112,
-    0,  112,  112,  112,  112,  112,  112,  112,  112,    0,
-  112,  112,  112,    0,    0,  112,  112,  112,  112,  144,
-  144,  144,    0,    0,  144,  144,  144,  144,  144,  144,
-  144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-  144,  144,  144,  144,  144,  144,    0,  144,  144,  144,
-  144,  144,  144,  144,    0,  144,  144,  144,  144,    0,
-    0,    0,  144,  144,  144,  144,    0,    0,  144,  144,
-  144,    0,    0,  144,  144,  144,  144,  141,  141,  141,
-    0,    0,  141,  141,  141,  141,  141,  141,  141,  141,
-  141,  141,  141,  141,  141,  141,  141,  141,  141,  141,
-  141,  141,  141,  141,    0,  141,  141,  141,  141,  141,
-  141,  141,    0,    0,  141,  141,  141,    0,    0,    0,
-  141,  141,  141,  141,    0,    0,  141,  141,  141,    0,
-    0,  141,  141,  141,  141,   62,   62,   62,    0,    0,
-   62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
+   66,   66,   66,   66,   66,   66,    0,   66,   66,   66,
+   66,   66,   66,   66,    0,   66,    0,    0,   66,   66,
+   66,   66,   66,   66,   66,   66,   66,    0,   66,   66,
+   66,    0,    0,   66,   66,   66,   66,  112,  112,  112,
+    0,    0,  112,  112,  112,  111,  111,  111,  111,  111,
+  111,  111,  112,  112,  112,  112,  112,  112,  112,  112,
+  112,  112,  112,  112,    0,  112,  112,  112,  112,  112,
+  112,  112,    0,    0,  112,  112,    0,  112,  112,  112,
+  112,  112,  112,  112,  112,    0,  112,  112,  112,    0,
+    0,  112,  112,  112,  112,  145,  145,  145,    0,    0,
+  145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+  145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+  145,  145,    0,  145,  145,  145,  145,  145,  145,  145,
+    0,  145,  145,  145,  145,    0,    0,    0,  145,  145,
+  145,  145,    0,    0,  145,  145,  145,    0,    0,  145,
+  145,  145,  145,  142,  142,  142,    0,    0,  142,  142,
+  142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+  142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+    0,  142,  142,  142,  142,  142,  142,  142,    0,    0,
+  142,  142,  142,    0,    0,    0,  142,  142,  142,  142,
+    0,    0,  142,  142,  142,    0,    0,  142,  142,  142,
+  142,   62,   62,   62,    0,    0,   62,   62,   62,   62,
    62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-   62,   62,    0,   62,   62,   62,    0,    0,    0,   62,
-    0,   62,    0,    0,   62,   62,   62,   62,   62,   62,
-   62,   62,   62,    0,   62,   62,   62,    0,    0,   62,
-   62,   62,   62,   63,   63,   63,    0,    0,   63,   63,
-   63,   63,   63,   63,   63,   63,   63,   63,   63,   63,
+   62,   62,   62,   62,   62,   62,   62,   62,    0,   62,
+   62,   62,    0,    0,    0,   62,    0,   62,    0,    0,
+   62,   62,   62,   62,   62,   62,   62,   62,   62,    0,
+   62,   62,   62,    0,    0,   62,   62,   62,   62,   63,
+   63,   63,    0,    0,   63,   63,   63,   63,   63,   63,
    63,   63,   63,   63,   63,   63,   63,   63,   63,   63,
-    0,   63,   63,   63,    0,    0,    0,   63,    0,   63,
-    0,    0,   63,   63,   63,   63,   63,   63,   63,   63,
-   63,    0,   63,   63,   63,    0,    0,   63,   63,   63,
-   63,  123,  123,  123,    0,    0,  123,  123,  123,    0,
-    0,    0,    0,    0,    0,    0,  123,  123,  123,  123,
-  123,  123,  123,  123,  123,  123,  123,  123,    0,  123,
-  123,  123,  123,  123,  123,  123,    0,    0,  123,  123,
-    0,  123,  123,  123,  123,  123,  123,  123,  123,    0,
-  123,  123,  123,    0,    0,  123,  123,  123,  123,   55,
-   55,   55,    0,    0,   55,   55,   55,    0,    0,    0,
+   63,   63,   63,   63,   63,   63,    0,   63,   63,   63,
+    0,    0,    0,   63,    0,   63,    0,    0,   63,   63,
+   63,   63,   63,   63,   63,   63,   63,    0,   63,   63,
+   63,    0,    0,   63,   63,   63,   63,  123,  123,  123,
+    0,    0,  123,  123,  123,    0,    0,    0,    0,    0,
+    0,    0,  123,  123,  123,  123,  123,  123,  123,  123,
+  123,  123,  123,  123,    0,  123,  123,  123,  123,  123,
+  123,  123,    0,    0,  123,  123,    0,  123,  123,  123,
+  123,  123,  123,  123,  123,    0,  123,  123,  123,    0,
+    0,  123,  123,  123,  123,   55,   55,   55,    0,    0,
+   55,   55,   55,    0,    0,    0,    0,    0,    0,    0,
+   55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+   55,   55,    0,   55,    0,    0,    0,    0,    0,   55,
     0,    0,    0,    0,   55,   55,   55,   55,   55,   55,
-   55,   55,   55,   55,   55,   55,    0,   55,    0,    0,
-    0,    0,    0,   55,    0,    0,    0,    0,   55,   55,
-   55,   55,   55,   55,   55,   55,   55,    0,   55,   55,
-   55,    0,    0,   55,   55,   55,   55,   56,   56,   56,
-    0,    0,   56,   56,   56,    0,    0,    0,    0,    0,
+   55,   55,   55,    0,   55,   55,   55,    0,    0,   55,
+   55,   55,   55,   56,   56,   56,    0,    0,   56,   56,
+   56,    0,    0,    0,    0,    0,    0,    0,   56,   56,
+   56,   56,   56,   56,   56,   56,   56,   56,   56,   56,
+    0,   56,    0,   44,   45,    0,    0,   56,    0,    0,
     0,    0,   56,   56,   56,   56,   56,   56,   56,   56,
-   56,   56,   56,   56,    0,   56,    0,   44,   45,    0,
-    0,   56,    0,    0,    0,    0,   56,   56,   56,   56,
-   56,   56,   56,   56,   56,    0,   56,   56,   56,    0,
-    0,   56,   56,   56,   56,    3,    4,    5,    0,    0,
-    0,    6,    0,    0,    0,    0,    7,    8,    9,   10,
-    0,   11,   12,   13,   14,    0,   15,   16,   17,    0,
-    0,   18,   19,   20,   21,   59,    0,    0,   83,    0,
-    0,    0,   76,   76,   76,   76,   76,   76,   76,   59,
-    0,   59,   59,    0,   59,   59,   59,   59,   59,   59,
-   59,    0,   59,   59,   59,   59,   59,   59,   59,  165,
-    0,   59,   59,    0,   59,   59,   59,    0,   59,   59,
-   59,   59,    0,   59,   59,   59,    0,    0,   59,   59,
-   59,   59,    0,    0,    0,    0,    3,    4,    5,  234,
-    0,    0,    6,    0,    0,    0,    0,    7,    8,    9,
-   10,    0,   11,   12,   13,   14,    0,   15,   16,   17,
-    0,    0,   18,   19,   20,   21,    3,    4,    5,    0,
-    0,    0,    6,    0,    0,    0,    0,    7,    8,    9,
-   10,    0,   11,   12,   13,  235,    0,   15,   16,   17,
-    0,    0,   18,   19,   20,   21,   83,    0,    0,    0,
-   76,   76,   76,   76,   76,   76,   76,   59,    0,   59,
-   59,   59,   59,   59,   59,   59,   59,   59,   59,    0,
-   59,   59,   59,   59,   59,   59,   59,    0,    0,   59,
-   59,    0,   59,   59,   59,    0,   59,   59,   59,   59,
-    0,   59,   59,   59,  123,    0,   59,   59,   59,   59,
-    0,    0,    0,  123,    0,  123,  123,  123,  123,  123,
-  123,  123,  123,  123,  123,    0,  123,  123,  123,  123,
-  123,  123,  123,    0,    0,  123,  123,    0,  123,  123,
-  123,    0,  123,  123,  123,  123,    0,  123,  123,  123,
-    0,    0,  123,  123,  123,  123,   35,   35,   35,    0,
-    0,   35,   35,   35,   36,   36,   36,    0,    0,   36,
-   36,   36,   35,    0,    0,    0,   37,   37,   37,    0,
-   36,   37,   37,   37,   38,   38,   38,    0,    0,   38,
-   38,   38,   37,    0,    0,    0,   39,   39,   39,   35,
-   38,   39,   39,   39,   40,   40,   40,   36,    0,   40,
-   40,   40,   39,    0,    0,    0,  124,  124,  124,   37,
-   40,  124,  124,  124,  125,  125,  125,   38,    0,  125,
-  125,  125,  124,    0,    0,    0,  126,  126,  126,   39,
-  125,  126,  126,  126,  127,  127,  127,   40,    0,  127,
-  127,  127,  126,    0,    0,    0,  128,  128,  128,  124,
-  127,  128,  128,  128,  129,  129,  129,  125,    0,  129,
-  129,  129,  128,    0,    0,    0,  130,  130,  130,  126,
-  129,  130,  130,  130,   54,   54,   54,  127,    0,   54,
-   54,   54,  130,    0,    0,    0,    0,  179,    0,  128,
-   54,    0,    0,    0,    0,    0,  114,  129,  115,  116,
-  117,  118,  119,  120,  121,  122,  123,  124,    0,  130,
-    0,    0,    0,    0,  298,    0,    0,   54,    0,    0,
-    0,    0,    0,  114,  180,  115,  116,  117,  118,  119,
-  120,  121,  122,  123,  124,    0,    0,    0,    0,    0,
-    0,  321,  105,  106,  107,  108,  109,  110,  111,    0,
-  114,  299,  115,  116,  117,  118,  119,  120,  121,  122,
-  123,  124,    0,    0,    0,    0,    0,    0,    3,    4,
-    5,    0,    0,  112,    6,    0,    0,  178,  322,    7,
-    8,    9,   71,    0,   11,   12,   13,   72,   81,   15,
-   16,   17,    0,    0,   18,   19,   20,   21,    3,    4,
-    5,    0,    0,    0,    6,    0,    0,    0,    0,    7,
-    8,    9,   10,  245,   11,   12,   13,   14,    0,   15,
-   16,   17,    0,    0,   18,   19,   20,   21,    3,    4,
-    5,    0,    0,    0,    6,    0,    0,    0,    0,    7,
-    8,    9,   10,  285,   11,   12,   13,   14,    0,   15,
-   16,   17,    0,    0,   18,   19,   20,   21,    3,    4,
-    5,    0,    0,    0,    6,    0,    0,    0,    0,    7,
-    8,    9,   71,    0,   11,   12,   13,   72,    0,   15,
-   16,   17,    0,    0,   18,   19,   20,   21,    3,    4,
-    5,    0,    0,    0,    6,    0,    0,    0,    0,    7,
-    8,    9,   10,    0,   11,   12,   13,   14,    0,   15,
-   16,   17,    0,    0,   18,   19,   20,   21,    3,    4,
-    5,    0,    0,    0,    6,    0,    0,    0,    0,    7,
-    8,    9,  248,    0,   11,   12,   13,   14,    0,   15,
-   16,   17,    0,    0,   18,   19,   20,   21,    3,    4,
-    5,    0,    0,    0,    6,    0,    0,    0,    0,    7,
-    8,    9,   10,    0,   11,   12,   13,  262,    0,   15,
-   16,   17,    0,    0,   18,   19,   20,   21,  168,  168,
-  168,    0,    0,    0,  168,    0,    0,    0,    0,  168,
-  168,  168,  168,    0,  168,  168,  168,  168,    0,  168,
-  168,  168,    0,    0,  168,  168,  168,  168,  114,    0,
+   56,    0,   56,   56,   56,    0,    0,   56,   56,   56,
+   56,    3,    4,    5,    0,    0,    0,    6,    0,    0,
+    0,    0,    7,    8,    9,   10,    0,   11,   12,   13,
+   14,    0,   15,   16,   17,    0,    0,   18,   19,   20,
+   21,   59,    0,    0,   83,    0,    0,    0,   76,   76,
+   76,   76,   76,   76,   76,   59,    0,   59,   59,    0,
+   59,   59,   59,   59,   59,   59,   59,    0,   59,   59,
+   59,   59,   59,   59,   59,  165,    0,   59,   59,    0,
+   59,   59,   59,    0,   59,   59,   59,   59,    0,   59,
+   59,   59,    0,    0,   59,   59,   59,   59,    0,    0,
+    0,    0,    3,    4,    5,  234,    0,    0,    6,    0,
+    0,    0,    0,    7,    8,    9,   10,    0,   11,   12,
+   13,   14,    0,   15,   16,   17,    0,    0,   18,   19,
+   20,   21,    3,    4,    5,    0,    0,    0,    6,    0,
+    0,    0,    0,    7,    8,    9,   10,    0,   11,   12,
+   13,  235,    0,   15,   16,   17,    0,    0,   18,   19,
+   20,   21,   83,    0,    0,    0,   76,   76,   76,   76,
+   76,   76,   76,   59,    0,   59,   59,   59,   59,   59,
+   59,   59,   59,   59,   59,    0,   59,   59,   59,   59,
+   59,   59,   59,    0,    0,   59,   59,    0,   59,   59,
+   59,    0,   59,   59,   59,   59,    0,   59,   59,   59,
+  123,    0,   59,   59,   59,   59,    0,    0,    0,  123,
+    0,  123,  123,  123,  123,  123,  123,  123,  123,  123,
+  123,    0,  123,  123,  123,  123,  123,  123,  123,    0,
+    0,  123,  123,    0,  123,  123,  123,    0,  123,  123,
+  123,  123,    0,  123,  123,  123,    0,    0,  123,  123,
+  123,  123,   33,   33,   33,    0,    0,   33,   33,   33,
+    0,    0,    0,    0,    0,    0,    0,   33,   33,   33,
+   33,   33,   33,   33,   33,   33,   33,   33,   33,    0,
+   37,   37,   37,    0,    0,   37,   37,   37,    0,    0,
+    0,    0,   38,   38,   38,   33,   37,   38,   38,   38,
+   39,   39,   39,    0,    0,   39,   39,   39,   38,    0,
+    0,    0,   40,   40,   40,    0,   39,   40,   40,   40,
+  124,  124,  124,   37,    0,  124,  124,  124,   40,    0,
+    0,    0,  125,  125,  125,   38,  124,  125,  125,  125,
+  126,  126,  126,   39,    0,  126,  126,  126,  125,    0,
+    0,    0,  127,  127,  127,   40,  126,  127,  127,  127,
+  128,  128,  128,  124,    0,  128,  128,  128,  127,    0,
+    0,    0,  129,  129,  129,  125,  128,  129,  129,  129,
+  130,  130,  130,  126,    0,  130,  130,  130,  129,    0,
+    0,    0,   54,   54,   54,  127,  130,   54,   54,   54,
+    0,    0,    0,  128,    0,    0,    0,    0,   54,    0,
+    0,    0,    0,  179,    0,  129,    0,    0,    0,    0,
+    0,    0,  114,  130,  115,  116,  117,  118,  119,  120,
+  121,  122,  123,  124,    0,   54,    0,    0,    0,    0,
+  298,   98,   99,  100,  101,  102,  103,  104,    0,  114,
+  180,  115,  116,  117,  118,  119,  120,  121,  122,  123,
+  124,    0,    0,    0,    0,    0,    0,  322,  105,  106,
+  107,  108,  109,  110,  111,    0,  114,  299,  115,  116,
+  117,  118,  119,  120,  121,  122,  123,  124,    0,    0,
+    0,    0,    0,    0,    3,    4,    5,    0,    0,  112,
+    6,    0,    0,  178,  323,    7,    8,    9,   71,    0,
+   11,   12,   13,   72,   81,   15,   16,   17,    0,    0,
+   18,   19,   20,   21,    3,    4,    5,    0,    0,    0,
+    6,    0,    0,    0,    0,    7,    8,    9,   10,  245,
+   11,   12,   13,   14,    0,   15,   16,   17,    0,    0,
+   18,   19,   20,   21,    3,    4,    5,    0,    0,    0,
+    6,    0,    0,    0,    0,    7,    8,    9,   10,  285,
+   11,   12,   13,   14,    0,   15,   16,   17,    0,    0,
+   18,   19,   20,   21,    3,    4,    5,    0,    0,    0,
+    6,    0,    0,    0,    0,    7,    8,    9,   71,    0,
+   11,   12,   13,   72,    0,   15,   16,   17,    0,    0,
+   18,   19,   20,   21,    3,    4,    5,    0,    0,    0,
+    6,    0,    0,    0,    0,    7,    8,    9,   10,    0,
+   11,   12,   13,   14,    0,   15,   16,   17,    0,    0,
+   18,   19,   20,   21,    3,    4,    5,    0,    0,    0,
+    6,    0,    0,    0,    0,    7,    8,    9,  248,    0,
+   11,   12,   13,   14,    0,   15,   16,   17,    0,    0,
+   18,   19,   20,   21,    3,    4,    5,    0,    0,    0,
+    6,    0,    0,    0,    0,    7,    8,    9,   10,    0,
+   11,   12,   13,  262,    0,   15,   16,   17,    0,    0,
+   18,   19,   20,   21,  169,  169,  169,    0,    0,    0,
+  169,    0,    0,    0,    0,  169,  169,  169,  169,    0,
+  169,  169,  169,  169,    0,  169,  169,  169,    0,    0,
+  169,  169,  169,  169,  114,    0,  115,  116,  117,  118,
+  119,  120,  121,  122,  123,  124,  114,    0,  115,  116,
+  117,  118,  119,  120,  121,  122,  123,  124,    0,    0,
+    0,  114,  180,  115,  116,  117,  118,  119,  120,  121,
+  122,  123,  124,  114,  273,  115,  116,  117,  118,  119,
+  120,  121,  122,  123,  124,    0,    0,    0,  114,  277,
   115,  116,  117,  118,  119,  120,  121,  122,  123,  124,
-  114,    0,  115,  116,  117,  118,  119,  120,  121,  122,
-  123,  124,    0,    0,    0,  114,  180,  115,  116,  117,
-  118,  119,  120,  121,  122,  123,  124,  114,  273,  115,
-  116,  117,  118,  119,  120,  121,  122,  123,  124,    0,
-    0,    0,  114,  277,  115,  116,  117,  118,  119,  120,
-  121,  122,  123,  124,  114,  280,  115,  116,  117,  118,
-  119,  120,  121,  122,  123,  124,   44,   45,    0,    0,
-  283,  117,  118,  119,  120,  121,  122,  123,  124,  279,
-    0,  114,  326,  115,  116,  117,  118,  119,  120,  121,
-  122,  123,  124,  114,    0,  115,  116,  117,  118,  119,
-  120,  121,  122,  123,  124,  113,   98,   99,  100,  101,
-  102,  103,  104,    0,  114,    0,  115,  116,  117,  118,
-  119,  120,  121,  122,  123,  124,  266,    0,    0,    0,
+  114,  280,  115,  116,  117,  118,  119,  120,  121,  122,
+  123,  124,   44,   45,    0,    0,  283,    0,    0,    0,
+    0,    0,    0,    0,    0,  244,    0,  114,  327,  115,
+  116,  117,  118,  119,  120,  121,  122,  123,  124,  114,
+  279,  115,  116,  117,  118,  119,  120,  121,  122,  123,
+  124,    0,    0,    0,  114,    0,  115,  116,  117,  118,
+  119,  120,  121,  122,  123,  124,  113,    0,    0,    0,
     0,    0,    0,    0,    0,  114,    0,  115,  116,  117,
-  118,  119,  120,  121,  122,  123,  124,  267,    0,    0,
+  118,  119,  120,  121,  122,  123,  124,  266,    0,    0,
     0,    0,    0,    0,    0,    0,  114,    0,  115,  116,
-  117,  118,  119,  120,  121,  122,  123,  124,  114,  304,
-  115,  116,  117,  118,  119,  120,  121,  122,  123,  124,
-  114,    0,  115,  116,  117,  118,  119,  120,  121,  122,
-  123,  124,  116,  117,  118,  119,  120,  121,  122,  123,
-  124,
+  117,  118,  119,  120,  121,  122,  123,  124,  267,    0,
+    0,    0,    0,    0,    0,    0,    0,  114,    0,  115,
+  116,  117,  118,  119,  120,  121,  122,  123,  124,  114,
+  304,  115,  116,  117,  118,  119,  120,  121,  122,  123,
+  124,  114,    0,  115,  116,  117,  118,  119,  120,  121,
+  122,  123,  124,  116,  117,  118,  119,  120,  121,  122,
+  123,  124,
 };
 static const short yycheck[] = {                          7,
-    0,  265,    4,    5,    6,    7,    8,  265,   10,   60,
+    0,  278,    4,    5,    6,    7,    8,  265,   10,   60,
    10,  298,   63,   64,  306,   66,  308,  259,  260,   70,
-    0,  301,  264,  265,  266,   25,   28,  259,  260,  265,
-   32,   15,   16,  224,   42,    4,    5,    6,  302,    8,
+    0,  298,  264,  265,  266,   25,   28,  299,  300,  301,
+   32,   15,   16,  265,   42,    4,    5,    6,  224,    8,
    42,  181,  259,  260,  302,   25,  259,  260,  261,  266,
-  265,  264,  265,  266,  278,   55,   36,  301,   58,   28,
-  302,   41,  275,   32,   43,   65,  302,  259,  260,   71,
-  262,   71,   51,   52,  298,   77,   55,   56,   57,   58,
-  299,  300,  301,   62,   68,  302,  261,  302,   72,  302,
-   90,   91,  296,  297,   78,  265,  265,   81,   98,   99,
+  265,  264,  265,  266,  301,   55,   36,  301,   58,   28,
+  302,   41,  275,   32,   43,   65,  298,  259,  260,   71,
+  302,   71,   51,   52,  266,   77,   55,   56,   57,   58,
+  265,  259,  260,   62,   68,  302,  261,  302,   72,  302,
+   90,   91,  301,  265,   78,  265,  265,   81,   98,   99,
   100,  101,  102,  103,  104,  105,  106,  107,  108,  109,
-  110,  111,   92,   93,  254,  255,  256,  265,  118,  119,
+  110,  111,   92,   93,  254,  255,  256,  302,  118,  119,
   120,  121,  122,  123,  124,  127,  128,  129,  130,  131,
-  321,  133,  302,  302,  134,  264,  265,  137,  295,  264,
+  302,  133,  302,  302,  134,  301,  322,  137,  265,  264,
   265,  281,  299,  300,  301,  125,  125,  147,  148,  306,
-  298,  151,  264,  265,  302,  301,  259,  260,  127,  128,
+  301,  151,  259,  260,  301,  262,  259,  260,  127,  128,
   129,  130,  131,  266,  133,  259,  260,  167,  152,  169,
-  264,  265,  266,  152,  153,  301,  176,  301,  157,  179,
-  159,  181,  256,  301,  184,  185,  301,  261,  290,  291,
-  292,  298,  243,  306,  296,  297,  247,  267,  268,  269,
-  270,  271,  272,  273,  204,  205,  206,  207,  302,  263,
-  299,  300,  301,  287,  288,  289,  224,  306,  301,  293,
-  264,  265,  224,  301,  298,  299,  300,  301,  298,  303,
-  304,  305,  306,  297,  308,  309,  310,  259,  260,  313,
-  314,  315,  316,  306,  266,  287,  248,  306,  248,  264,
-  265,  325,  326,  318,  254,  255,  256,  331,  295,  263,
-  288,  289,  290,  291,  292,  259,  260,  267,  296,  297,
-  259,  260,  261,  323,  274,  302,  259,  260,  259,  260,
-  261,  281,  278,  264,  265,  266,  263,  287,  263,  289,
-  290,  302,  265,  274,  275,  276,  277,  278,  279,  280,
-  281,  282,  283,  284,  285,  259,  260,  261,  265,  288,
-  302,  256,  260,  321,  259,  260,  261,  262,  265,  321,
-  320,  302,  263,  303,  303,  301,  274,  266,  276,  277,
-  278,  279,  280,  281,  282,  283,  284,  285,  259,  260,
-  261,  306,  287,  288,  289,  306,  325,  326,  293,  302,
-  306,  306,  298,  298,  299,  300,  301,  263,  303,  304,
-  305,  306,  302,  308,  309,  310,  311,  312,  313,  314,
-  315,  316,  317,  318,  319,  320,  321,  322,  302,  324,
-  302,  248,  327,  328,  329,  330,  256,  302,  302,  259,
-  260,  261,  262,  302,  259,  260,  261,  185,  303,  264,
-  265,  266,  280,  281,  282,  283,  284,  285,  267,  274,
-  275,  276,  277,  278,  279,   25,   -1,  287,  288,  289,
-   -1,   -1,   -1,  293,   -1,   -1,   -1,   -1,  298,  299,
-  300,  301,   -1,  303,  304,  305,  306,  302,  308,  309,
-  310,  311,  312,  313,  314,  315,  316,  317,  318,  319,
-  320,  321,  322,   -1,  324,   -1,   -1,  327,  328,  329,
-  330,  256,   -1,   -1,  259,  260,  261,   -1,   -1,  259,
-  260,  261,   -1,   -1,  264,  265,  266,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,  274,  275,  276,  277,   -1,   -1,
-   -1,   -1,  287,  288,  289,   -1,   -1,   -1,  293,   -1,
-   -1,   -1,   -1,  298,  299,  300,  301,   -1,  303,  304,
-  305,  306,  302,  308,  309,  310,  311,  312,  313,  314,
-  315,  316,  317,  318,  319,  320,  321,  322,   -1,  324,
-   -1,   -1,  327,  328,  329,  330,  256,   -1,   -1,  259,
-  260,  261,   -1,   -1,  259,  260,  261,   -1,   -1,  264,
-  265,  266,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  274,
-  275,  276,   -1,   -1,   -1,   -1,   -1,  287,  288,  289,
-   -1,   -1,   -1,  293,   -1,   -1,   -1,   -1,  298,  299,
-  300,  301,   -1,  303,  304,  305,  306,  302,  308,  309,
-  310,  311,  312,  313,  314,  315,  316,  317,  318,  319,
-  320,  321,  322,   -1,  324,   -1,   -1,  327,  328,  329,
-  330,  259,  260,  261,   -1,  263,  264,  265,  266,  267,
-  268,  269,  270,  271,  272,  273,  274,  275,  276,  277,
-  278,  279,  280,  281,  282,  283,  284,  285,   -1,  287,
-  288,  289,  290,  291,  292,  293,   -1,  295,  296,  297,
-  298,  299,  300,  301,  302,  303,  304,  305,  306,   -1,
-  308,  309,  310,   -1,   -1,  313,  314,  315,  316,  259,
-  260,  261,   -1,  263,  264,  265,  266,  267,  268,  269,
-  270,  271,  272,  273,  274,  275,  276,  277,  278,  279,
-  280,  281,  282,  283,  284,  285,   -1,  287,  288,  289,
-  290,  291,  292,  293,   -1,  295,  296,  297,  298,  299,
-  300,  301,  302,  303,  304,  305,  306,   -1,  308,  309,
-  310,   -1,   -1,  313,  314,  315,  316,  259,  260,  261,
+  264,  265,  266,  152,  153,  302,  176,  301,  157,  179,
+  159,  181,  256,  306,  184,  185,  298,  261,  290,  291,
+  292,  263,  243,  301,  296,  297,  247,  267,  268,  269,
+  270,  271,  272,  273,  204,  205,  206,  207,  302,  259,
+  260,  261,  301,  287,  288,  289,  224,  296,  297,  293,
+  264,  265,  224,  306,  298,  299,  300,  301,  298,  303,
+  304,  305,  306,  297,  308,  309,  310,  264,  265,  313,
+  314,  315,  316,  259,  260,  261,  248,  287,  248,  264,
+  265,  325,  326,  306,  254,  255,  256,  331,  264,  265,
+  259,  260,  261,  259,  260,  261,  295,  267,  264,  265,
+  266,  295,  259,  260,  274,  299,  300,  301,  274,  275,
+  276,  281,  306,  259,  260,  323,  318,  287,  263,  289,
+  290,  302,  259,  260,  261,  263,  278,  264,  265,  266,
+  265,  263,  263,  306,  302,  302,  302,  256,  275,  288,
+  259,  260,  261,  262,  322,  265,  301,  306,  266,  265,
+  322,  321,  263,  303,  303,  288,  289,  290,  291,  292,
+  302,  302,  306,  296,  297,  302,  306,  303,  287,  288,
+  289,  298,  306,  302,  293,  248,  302,  326,  327,  298,
+  299,  300,  301,  267,  303,  304,  305,  306,  302,  308,
+  309,  310,  311,  312,  313,  314,  315,  316,  317,  318,
+  319,  320,  321,  322,  302,  324,  302,  185,  327,  328,
+  329,  330,  256,   25,   -1,  259,  260,  261,  262,   -1,
+  259,  260,  261,   -1,   -1,  264,  265,  266,  280,  281,
+  282,  283,  284,  285,   -1,  274,  275,  276,  277,  278,
+  279,   -1,   -1,  287,  288,  289,   -1,   -1,   -1,  293,
+   -1,   -1,   -1,   -1,  298,  299,  300,  301,   -1,  303,
+  304,  305,  306,  302,  308,  309,  310,  311,  312,  313,
+  314,  315,  316,  317,  318,  319,  320,  321,  322,   -1,
+  324,   -1,   -1,  327,  328,  329,  330,  256,   -1,   -1,
+  259,  260,  261,   -1,   -1,  259,  260,  261,   -1,   -1,
+  264,  265,  266,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  274,  275,  276,  277,   -1,   -1,   -1,   -1,  287,  288,
+  289,   -1,   -1,   -1,  293,   -1,   -1,   -1,   -1,  298,
+  299,  300,  301,   -1,  303,  304,  305,  306,  302,  308,
+  309,  310,  311,  312,  313,  314,  315,  316,  317,  318,
+  319,  320,  321,  322,   -1,  324,   -1,   -1,  327,  328,
+  329,  330,  256,   -1,   -1,  259,  260,  261,   -1,   -1,
+  259,  260,  261,   -1,   -1,  264,  265,  266,  278,  279,
+  280,  281,  282,  283,  284,  285,  275,   -1,   -1,   -1,
+   -1,   -1,   -1,  287,  288,  289,   -1,   -1,   -1,  293,
+   -1,   -1,   -1,   -1,  298,  299,  300,  301,   -1,  303,
+  304,  305,  306,  302,  308,  309,  310,  311,  312,  313,
+  314,  315,  316,  317,  318,  319,  320,  321,  322,   -1,
+  324,   -1,   -1,  327,  328,  329,  330,  259,  260,  261,
    -1,  263,  264,  265,  266,  267,  268,  269,  270,  271,
   272,  273,  274,  275,  276,  277,  278,  279,  280,  281,
   282,  283,  284,  285,   -1,  287,  288,  289,  290,  291,
-  292,  293,   -1,  295,  296,  297,   -1,  299,  300,  301,
+  292,  293,   -1,  295,  296,  297,  298,  299,  300,  301,
   302,  303,  304,  305,  306,   -1,  308,  309,  310,   -1,
    -1,  313,  314,  315,  316,  259,  260,  261,   -1,  263,
   264,  265,  266,  267,  268,  269,  270,  271,  272,  273,
   274,  275,  276,  277,  278,  279,  280,  281,  282,  283,
   284,  285,   -1,  287,  288,  289,  290,  291,  292,  293,
-   -1,   -1,  296,  297,   -1,  299,  300,  301,  302,  303,
+   -1,  295,  296,  297,  298,  299,  300,  301,  302,  303,
   304,  305,  306,   -1,  308,  309,  310,   -1,   -1,  313,
-  314,  315,  316,  259,  260,  261,   -1,   -1,  264,  265,
+  314,  315,  316,  259,  260,  261,   -1,  263,  264,  265,
   266,  267,  268,  269,  270,  271,  272,  273,  274,  275,
   276,  277,  278,  279,  280,  281,  282,  283,  284,  285,
    -1,  287,  288,  289,  290,  291,  292,  293,   -1,  295,
   296,  297,   -1,  299,  300,  301,  302,  303,  304,  305,
   306,   -1,  308,  309,  310,   -1,   -1,  313,  314,  315,
-  316,  259,  260,  261,   -1,   -1,  264,  265,  266,  267,
+  316,  259,  260,  261,   -1,  263,  264,  265,  266,  267,
   268,  269,  270,  271,  272,  273,  274,  275,  276,  277,
   278,  279,  280,  281,  282,  283,  284,  285,   -1,  287,
   288,  289,  290,  291,  292,  293,   -1,   -1,  296,  297,
-  298,  299,  300,  301,  302,  303,  304,  305,  306,   -1,
+   -1,  299,  300,  301,  302,  303,  304,  305,  306,   -1,
   308,  309,  310,   -1,   -1,  313,  314,  315,  316,  259,
   260,  261,   -1,   -1,  264,  265,  266,  267,  268,  269,
   270,  271,  272,  273,  274,  275,  276,  277,  278,  279,
   280,  281,  282,  283,  284,  285,   -1,  287,  288,  289,
-  290,  291,  292,  293,   -1,  295,  296,   -1,  298,  299,
+  290,  291,  292,  293,   -1,  295,  296,  297,   -1,  299,
   300,  301,  302,  303,  304,  305,  306,   -1,  308,  309,
   310,   -1,   -1,  313,  314,  315,  316,  259,  260,  261,
    -1,   -1,  264,  265,  266,  267,  268,  269,  270,  271,
   272,  273,  274,  275,  276,  277,  278,  279,  280,  281,
   282,  283,  284,  285,   -1,  287,  288,  289,  290,  291,
-  292,  293,   -1,  295,  296,  297,   -1,  299,  300,  301,
+  292,  293,   -1,   -1,  296,  297,  298,  299,  300,  301,
   302,  303,  304,  305,  306,   -1,  308,  309,  310,   -1,
    -1,  313,  314,  315,  316,  259,  260,  261,   -1,   -1,
   264,  265,  266,  267,  268,  269,  270,  271,  272,  273,
   274,  275,  276,  277,  278,  279,  280,  281,  282,  283,
   284,  285,   -1,  287,  288,  289,  290,  291,  292,  293,
-   -1,  295,   -1,   -1,  298,  299,  300,  301,  302,  303,
+   -1,  295,  296,   -1,  298,  299,  300,  301,  302,  303,
   304,  305,  306,   -1,  308,  309,  310,   -1,   -1,  313,
   314,  315,  316,  259,  260,  261,   -1,   -1,  264,  265,
   266,  267,  268,  269,  270,  271,  272,  273,  274,  275,
   276,  277,  278,  279,  280,  281,  282,  283,  284,  285,
    -1,  287,  288,  289,  290,  291,  292,  293,   -1,  295,
-   -1,   -1,  298,  299,  300,  301,  302,  303,  304,  305,
+  296,  297,   -1,  299,  300,  301,  302,  303,  304,  305,
   306,   -1,  308,  309,  310,   -1,   -1,  313,  314,  315,
   316,  259,  260,  261,   -1,   -1,  264,  265,  266,  267,
   268,  269,  270,  271,  272,  273,  274,  275,  276,  277,
@@ -795,143 +786,158 @@ static const short yycheck[] = {                          7,
   316,  259,  260,  261,   -1,   -1,  264,  265,  266,  267,
   268,  269,  270,  271,  272,  273,  274,  275,  276,  277,
   278,  279,  280,  281,  282,  283,  284,  285,   -1,  287,
-  288,  289,  290,  291,  292,  293,   -1,   -1,  296,  297,
-   -1,  299,  300,  301,  302,  303,  304,  305,  306,   -1,
+  288,  289,  290,  291,  292,  293,   -1,  295,   -1,   -1,
+  298,  299,  300,  301,  302,  303,  304,  305,  306,   -1,
   308,  309,  310,   -1,   -1,  313,  314,  315,  316,  259,
   260,  261,   -1,   -1,  264,  265,  266,  267,  268,  269,
   270,  271,  272,  273,  274,  275,  276,  277,  278,  279,
   280,  281,  282,  283,  284,  285,   -1,  287,  288,  289,
-  290,  291,  292,  293,   -1,  295,  296,  297,  298,   -1,
-   -1,   -1,  302,  303,  304,  305,   -1,   -1,  308,  309,
+  290,  291,  292,  293,   -1,  295,   -1,   -1,  298,  299,
+  300,  301,  302,  303,  304,  305,  306,   -1,  308,  309,
   310,   -1,   -1,  313,  314,  315,  316,  259,  260,  261,
    -1,   -1,  264,  265,  266,  267,  268,  269,  270,  271,
   272,  273,  274,  275,  276,  277,  278,  279,  280,  281,
   282,  283,  284,  285,   -1,  287,  288,  289,  290,  291,
-  292,  293,   -1,   -1,  296,  297,  298,   -1,   -1,   -1,
-  302,  303,  304,  305,   -1,   -1,  308,  309,  310,   -1,
+  292,  293,   -1,   -1,  296,  297,   -1,  299,  300,  301,
+  302,  303,  304,  305,  306,   -1,  308,  309,  310,   -1,
    -1,  313,  314,  315,  316,  259,  260,  261,   -1,   -1,
   264,  265,  266,  267,  268,  269,  270,  271,  272,  273,
   274,  275,  276,  277,  278,  279,  280,  281,  282,  283,
-  284,  285,   -1,  287,  288,  289,   -1,   -1,   -1,  293,
-   -1,  295,   -1,   -1,  298,  299,  300,  301,  302,  303,
-  304,  305,  306,   -1,  308,  309,  310,   -1,   -1,  313,
+  284,  285,   -1,  287,  288,  289,  290,  291,  292,  293,
+   -1,  295,  296,  297,  298,   -1,   -1,   -1,  302,  303,
+  304,  305,   -1,   -1,  308,  309,  310,   -1,   -1,  313,
   314,  315,  316,  259,  260,  261,   -1,   -1,  264,  265,
   266,  267,  268,  269,  270,  271,  272,  273,  274,  275,
   276,  277,  278,  279,  280,  281,  282,  283,  284,  285,
-   -1,  287,  288,  289,   -1,   -1,   -1,  293,   -1,  295,
-   -1,   -1,  298,  299,  300,  301,  302,  303,  304,  305,
-  306,   -1,  308,  309,  310,   -1,   -1,  313,  314,  315,
-  316,  259,  260,  261,   -1,   -1,  264,  265,  266,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,  274,  275,  276,  277,
+   -1,  287,  288,  289,  290,  291,  292,  293,   -1,   -1,
+  296,  297,  298,   -1,   -1,   -1,  302,  303,  304,  305,
+   -1,   -1,  308,  309,  310,   -1,   -1,  313,  314,  315,
+  316,  259,  260,  261,   -1,   -1,  264,  265,  266,  267,
+  268,  269,  270,  271,  272,  273,  274,  275,  276,  277,
   278,  279,  280,  281,  282,  283,  284,  285,   -1,  287,
-  288,  289,  290,  291,  292,  293,   -1,   -1,  296,  297,
-   -1,  299,  300,  301,  302,  303,  304,  305,  306,   -1,
+  288,  289,   -1,   -1,   -1,  293,   -1,  295,   -1,   -1,
+  298,  299,  300,  301,  302,  303,  304,  305,  306,   -1,
   308,  309,  310,   -1,   -1,  313,  314,  315,  316,  259,
-  260,  261,   -1,   -1,  264,  265,  266,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,  274,  275,  276,  277,  278,  279,
-  280,  281,  282,  283,  284,  285,   -1,  287,   -1,   -1,
-   -1,   -1,   -1,  293,   -1,   -1,   -1,   -1,  298,  299,
+  260,  261,   -1,   -1,  264,  265,  266,  267,  268,  269,
+  270,  271,  272,  273,  274,  275,  276,  277,  278,  279,
+  280,  281,  282,  283,  284,  285,   -1,  287,  288,  289,
+   -1,   -1,   -1,  293,   -1,  295,   -1,   -1,  298,  299,
   300,  301,  302,  303,  304,  305,  306,   -1,  308,  309,
   310,   -1,   -1,  313,  314,  315,  316,  259,  260,  261,
    -1,   -1,  264,  265,  266,   -1,   -1,   -1,   -1,   -1,
    -1,   -1,  274,  275,  276,  277,  278,  279,  280,  281,
-  282,  283,  284,  285,   -1,  287,   -1,  259,  260,   -1,
-   -1,  293,   -1,   -1,   -1,   -1,  298,  299,  300,  301,
+  282,  283,  284,  285,   -1,  287,  288,  289,  290,  291,
+  292,  293,   -1,   -1,  296,  297,   -1,  299,  300,  301,
   302,  303,  304,  305,  306,   -1,  308,  309,  310,   -1,
-   -1,  313,  314,  315,  316,  287,  288,  289,   -1,   -1,
-   -1,  293,   -1,   -1,   -1,   -1,  298,  299,  300,  301,
-   -1,  303,  304,  305,  306,   -1,  308,  309,  310,   -1,
-   -1,  313,  314,  315,  316,  260,   -1,   -1,  263,   -1,
-   -1,   -1,  267,  268,  269,  270,  271,  272,  273,  274,
-   -1,  276,  277,   -1,  279,  280,  281,  282,  283,  284,
-  285,   -1,  287,  288,  289,  290,  291,  292,  293,  260,
-   -1,  296,  297,   -1,  299,  300,  301,   -1,  303,  304,
+   -1,  313,  314,  315,  316,  259,  260,  261,   -1,   -1,
+  264,  265,  266,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  274,  275,  276,  277,  278,  279,  280,  281,  282,  283,
+  284,  285,   -1,  287,   -1,   -1,   -1,   -1,   -1,  293,
+   -1,   -1,   -1,   -1,  298,  299,  300,  301,  302,  303,
+  304,  305,  306,   -1,  308,  309,  310,   -1,   -1,  313,
+  314,  315,  316,  259,  260,  261,   -1,   -1,  264,  265,
+  266,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  274,  275,
+  276,  277,  278,  279,  280,  281,  282,  283,  284,  285,
+   -1,  287,   -1,  259,  260,   -1,   -1,  293,   -1,   -1,
+   -1,   -1,  298,  299,  300,  301,  302,  303,  304,  305,
+  306,   -1,  308,  309,  310,   -1,   -1,  313,  314,  315,
+  316,  287,  288,  289,   -1,   -1,   -1,  293,   -1,   -1,
+   -1,   -1,  298,  299,  300,  301,   -1,  303,  304,  305,
+  306,   -1,  308,  309,  310,   -1,   -1,  313,  314,  315,
+  316,  260,   -1,   -1,  263,   -1,   -1,   -1,  267,  268,
+  269,  270,  271,  272,  273,  274,   -1,  276,  277,   -1,
+  279,  280,  281,  282,  283,  284,  285,   -1,  287,  288,
+  289,  290,  291,  292,  293,  260,   -1,  296,  297,   -1,
+  299,  300,  301,   -1,  303,  304,  305,  306,   -1,  308,
+  309,  310,   -1,   -1,  313,  314,  315,  316,   -1,   -1,
+   -1,   -1,  287,  288,  289,  260,   -1,   -1,  293,   -1,
+   -1,   -1,   -1,  298,  299,  300,  301,   -1,  303,  304,
   305,  306,   -1,  308,  309,  310,   -1,   -1,  313,  314,
-  315,  316,   -1,   -1,   -1,   -1,  287,  288,  289,  260,
-   -1,   -1,  293,   -1,   -1,   -1,   -1,  298,  299,  300,
-  301,   -1,  303,  304,  305,  306,   -1,  308,  309,  310,
-   -1,   -1,  313,  314,  315,  316,  287,  288,  289,   -1,
-   -1,   -1,  293,   -1,   -1,   -1,   -1,  298,  299,  300,
-  301,   -1,  303,  304,  305,  306,   -1,  308,  309,  310,
-   -1,   -1,  313,  314,  315,  316,  263,   -1,   -1,   -1,
-  267,  268,  269,  270,  271,  272,  273,  274,   -1,  276,
-  277,  278,  279,  280,  281,  282,  283,  284,  285,   -1,
-  287,  288,  289,  290,  291,  292,  293,   -1,   -1,  296,
-  297,   -1,  299,  300,  301,   -1,  303,  304,  305,  306,
-   -1,  308,  309,  310,  265,   -1,  313,  314,  315,  316,
-   -1,   -1,   -1,  274,   -1,  276,  277,  278,  279,  280,
+  315,  316,  287,  288,  289,   -1,   -1,   -1,  293,   -1,
+   -1,   -1,   -1,  298,  299,  300,  301,   -1,  303,  304,
+  305,  306,   -1,  308,  309,  310,   -1,   -1,  313,  314,
+  315,  316,  263,   -1,   -1,   -1,  267,  268,  269,  270,
+  271,  272,  273,  274,   -1,  276,  277,  278,  279,  280,
   281,  282,  283,  284,  285,   -1,  287,  288,  289,  290,
   291,  292,  293,   -1,   -1,  296,  297,   -1,  299,  300,
   301,   -1,  303,  304,  305,  306,   -1,  308,  309,  310,
-   -1,   -1,  313,  314,  315,  316,  259,  260,  261,   -1,
-   -1,  264,  265,  266,  259,  260,  261,   -1,   -1,  264,
-  265,  266,  275,   -1,   -1,   -1,  259,  260,  261,   -1,
-  275,  264,  265,  266,  259,  260,  261,   -1,   -1,  264,
-  265,  266,  275,   -1,   -1,   -1,  259,  260,  261,  302,
-  275,  264,  265,  266,  259,  260,  261,  302,   -1,  264,
-  265,  266,  275,   -1,   -1,   -1,  259,  260,  261,  302,
-  275,  264,  265,  266,  259,  260,  261,  302,   -1,  264,
-  265,  266,  275,   -1,   -1,   -1,  259,  260,  261,  302,
-  275,  264,  265,  266,  259,  260,  261,  302,   -1,  264,
-  265,  266,  275,   -1,   -1,   -1,  259,  260,  261,  302,
-  275,  264,  265,  266,  259,  260,  261,  302,   -1,  264,
-  265,  266,  275,   -1,   -1,   -1,  259,  260,  261,  302,
-  275,  264,  265,  266,  259,  260,  261,  302,   -1,  264,
-  265,  266,  275,   -1,   -1,   -1,   -1,  265,   -1,  302,
-  275,   -1,   -1,   -1,   -1,   -1,  274,  302,  276,  277,
-  278,  279,  280,  281,  282,  283,  284,  285,   -1,  302,
-   -1,   -1,   -1,   -1,  265,   -1,   -1,  302,   -1,   -1,
-   -1,   -1,   -1,  274,  302,  276,  277,  278,  279,  280,
-  281,  282,  283,  284,  285,   -1,   -1,   -1,   -1,   -1,
-   -1,  265,  267,  268,  269,  270,  271,  272,  273,   -1,
-  274,  302,  276,  277,  278,  279,  280,  281,  282,  283,
-  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,  287,  288,
-  289,   -1,   -1,  298,  293,   -1,   -1,  302,  302,  298,
-  299,  300,  301,   -1,  303,  304,  305,  306,  307,  308,
-  309,  310,   -1,   -1,  313,  314,  315,  316,  287,  288,
-  289,   -1,   -1,   -1,  293,   -1,   -1,   -1,   -1,  298,
-  299,  300,  301,  302,  303,  304,  305,  306,   -1,  308,
-  309,  310,   -1,   -1,  313,  314,  315,  316,  287,  288,
-  289,   -1,   -1,   -1,  293,   -1,   -1,   -1,   -1,  298,
-  299,  300,  301,  302,  303,  304,  305,  306,   -1,  308,
-  309,  310,   -1,   -1,  313,  314,  315,  316,  287,  288,
-  289,   -1,   -1,   -1,  293,   -1,   -1,   -1,   -1,  298,
-  299,  300,  301,   -1,  303,  304,  305,  306,   -1,  308,
-  309,  310,   -1,   -1,  313,  314,  315,  316,  287,  288,
-  289,   -1,   -1,   -1,  293,   -1,   -1,   -1,   -1,  298,
-  299,  300,  301,   -1,  303,  304,  305,  306,   -1,  308,
-  309,  310,   -1,   -1,  313,  314,  315,  316,  287,  288,
-  289,   -1,   -1,   -1,  293,   -1,   -1,   -1,   -1,  298,
-  299,  300,  301,   -1,  303,  304,  305,  306,   -1,  308,
-  309,  310,   -1,   -1,  313,  314,  315,  316,  287,  288,
-  289,   -1,   -1,   -1,  293,   -1,   -1,   -1,   -1,  298,
-  299,  300,  301,   -1,  303,  304,  305,  306,   -1,  308,
-  309,  310,   -1,   -1,  313,  314,  315,  316,  287,  288,
-  289,   -1,   -1,   -1,  293,   -1,   -1,   -1,   -1,  298,
-  299,  300,  301,   -1,  303,  304,  305,  306,   -1,  308,
-  309,  310,   -1,   -1,  313,  314,  315,  316,  274,   -1,
-  276,  277,  278,  279,  280,  281,  282,  283,  284,  285,
-  274,   -1,  276,  277,  278,  279,  280,  281,  282,  283,
-  284,  285,   -1,   -1,   -1,  274,  302,  276,  277,  278,
-  279,  280,  281,  282,  283,  284,  285,  274,  302,  276,
+  265,   -1,  313,  314,  315,  316,   -1,   -1,   -1,  274,
+   -1,  276,  277,  278,  279,  280,  281,  282,  283,  284,
+  285,   -1,  287,  288,  289,  290,  291,  292,  293,   -1,
+   -1,  296,  297,   -1,  299,  300,  301,   -1,  303,  304,
+  305,  306,   -1,  308,  309,  310,   -1,   -1,  313,  314,
+  315,  316,  259,  260,  261,   -1,   -1,  264,  265,  266,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  274,  275,  276,
   277,  278,  279,  280,  281,  282,  283,  284,  285,   -1,
+  259,  260,  261,   -1,   -1,  264,  265,  266,   -1,   -1,
+   -1,   -1,  259,  260,  261,  302,  275,  264,  265,  266,
+  259,  260,  261,   -1,   -1,  264,  265,  266,  275,   -1,
+   -1,   -1,  259,  260,  261,   -1,  275,  264,  265,  266,
+  259,  260,  261,  302,   -1,  264,  265,  266,  275,   -1,
+   -1,   -1,  259,  260,  261,  302,  275,  264,  265,  266,
+  259,  260,  261,  302,   -1,  264,  265,  266,  275,   -1,
+   -1,   -1,  259,  260,  261,  302,  275,  264,  265,  266,
+  259,  260,  261,  302,   -1,  264,  265,  266,  275,   -1,
+   -1,   -1,  259,  260,  261,  302,  275,  264,  265,  266,
+  259,  260,  261,  302,   -1,  264,  265,  266,  275,   -1,
+   -1,   -1,  259,  260,  261,  302,  275,  264,  265,  266,
+   -1,   -1,   -1,  302,   -1,   -1,   -1,   -1,  275,   -1,
+   -1,   -1,   -1,  265,   -1,  302,   -1,   -1,   -1,   -1,
    -1,   -1,  274,  302,  276,  277,  278,  279,  280,  281,
-  282,  283,  284,  285,  274,  302,  276,  277,  278,  279,
-  280,  281,  282,  283,  284,  285,  259,  260,   -1,   -1,
-  302,  278,  279,  280,  281,  282,  283,  284,  285,  260,
+  282,  283,  284,  285,   -1,  302,   -1,   -1,   -1,   -1,
+  265,  267,  268,  269,  270,  271,  272,  273,   -1,  274,
+  302,  276,  277,  278,  279,  280,  281,  282,  283,  284,
+  285,   -1,   -1,   -1,   -1,   -1,   -1,  265,  267,  268,
+  269,  270,  271,  272,  273,   -1,  274,  302,  276,  277,
+  278,  279,  280,  281,  282,  283,  284,  285,   -1,   -1,
+   -1,   -1,   -1,   -1,  287,  288,  289,   -1,   -1,  298,
+  293,   -1,   -1,  302,  302,  298,  299,  300,  301,   -1,
+  303,  304,  305,  306,  307,  308,  309,  310,   -1,   -1,
+  313,  314,  315,  316,  287,  288,  289,   -1,   -1,   -1,
+  293,   -1,   -1,   -1,   -1,  298,  299,  300,  301,  302,
+  303,  304,  305,  306,   -1,  308,  309,  310,   -1,   -1,
+  313,  314,  315,  316,  287,  288,  289,   -1,   -1,   -1,
+  293,   -1,   -1,   -1,   -1,  298,  299,  300,  301,  302,
+  303,  304,  305,  306,   -1,  308,  309,  310,   -1,   -1,
+  313,  314,  315,  316,  287,  288,  289,   -1,   -1,   -1,
+  293,   -1,   -1,   -1,   -1,  298,  299,  300,  301,   -1,
+  303,  304,  305,  306,   -1,  308,  309,  310,   -1,   -1,
+  313,  314,  315,  316,  287,  288,  289,   -1,   -1,   -1,
+  293,   -1,   -1,   -1,   -1,  298,  299,  300,  301,   -1,
+  303,  304,  305,  306,   -1,  308,  309,  310,   -1,   -1,
+  313,  314,  315,  316,  287,  288,  289,   -1,   -1,   -1,
+  293,   -1,   -1,   -1,   -1,  298,  299,  300,  301,   -1,
+  303,  304,  305,  306,   -1,  308,  309,  310,   -1,   -1,
+  313,  314,  315,  316,  287,  288,  289,   -1,   -1,   -1,
+  293,   -1,   -1,   -1,   -1,  298,  299,  300,  301,   -1,
+  303,  304,  305,  306,   -1,  308,  309,  310,   -1,   -1,
+  313,  314,  315,  316,  287,  288,  289,   -1,   -1,   -1,
+  293,   -1,   -1,   -1,   -1,  298,  299,  300,  301,   -1,
+  303,  304,  305,  306,   -1,  308,  309,  310,   -1,   -1,
+  313,  314,  315,  316,  274,   -1,  276,  277,  278,  279,
+  280,  281,  282,  283,  284,  285,  274,   -1,  276,  277,
+  278,  279,  280,  281,  282,  283,  284,  285,   -1,   -1,
    -1,  274,  302,  276,  277,  278,  279,  280,  281,  282,
-  283,  284,  285,  274,   -1,  276,  277,  278,  279,  280,
-  281,  282,  283,  284,  285,  265,  267,  268,  269,  270,
-  271,  272,  273,   -1,  274,   -1,  276,  277,  278,  279,
+  283,  284,  285,  274,  302,  276,  277,  278,  279,  280,
+  281,  282,  283,  284,  285,   -1,   -1,   -1,  274,  302,
+  276,  277,  278,  279,  280,  281,  282,  283,  284,  285,
+  274,  302,  276,  277,  278,  279,  280,  281,  282,  283,
+  284,  285,  259,  260,   -1,   -1,  302,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  260,   -1,  274,  302,  276,
+  277,  278,  279,  280,  281,  282,  283,  284,  285,  274,
+  260,  276,  277,  278,  279,  280,  281,  282,  283,  284,
+  285,   -1,   -1,   -1,  274,   -1,  276,  277,  278,  279,
   280,  281,  282,  283,  284,  285,  265,   -1,   -1,   -1,
    -1,   -1,   -1,   -1,   -1,  274,   -1,  276,  277,  278,
   279,  280,  281,  282,  283,  284,  285,  265,   -1,   -1,
    -1,   -1,   -1,   -1,   -1,   -1,  274,   -1,  276,  277,
-  278,  279,  280,  281,  282,  283,  284,  285,  274,  275,
-  276,  277,  278,  279,  280,  281,  282,  283,  284,  285,
-  274,   -1,  276,  277,  278,  279,  280,  281,  282,  283,
-  284,  285,  277,  278,  279,  280,  281,  282,  283,  284,
-  285,
+  278,  279,  280,  281,  282,  283,  284,  285,  265,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  274,   -1,  276,
+  277,  278,  279,  280,  281,  282,  283,  284,  285,  274,
+  275,  276,  277,  278,  279,  280,  281,  282,  283,  284,
+  285,  274,   -1,  276,  277,  278,  279,  280,  281,  282,
+  283,  284,  285,  277,  278,  279,  280,  281,  282,  283,
+  284,  285,
 };
 #define YYFINAL 25
 #ifndef YYDEBUG
@@ -1094,6 +1100,7 @@ static const char *yyrule[] = {
 "split_back : RPAREN",
 "split_back : COMMA expr RPAREN",
 "p_expr : MATCH_FUNC LPAREN expr COMMA re_arg RPAREN",
+"p_expr : MATCH_FUNC LPAREN expr COMMA re_arg COMMA ID RPAREN",
 "re_arg : expr",
 "statement : EXIT separator",
 "statement : EXIT expr separator",
@@ -1168,7 +1175,7 @@ typedef struct {
 } YYSTACKDATA;
 /* variables for the parser stack */
 static YYSTACKDATA yystack;
-#line 1162 "parse.y"
+#line 1168 "parse.y"
 
 /* resize the code for a user function */
 
@@ -1223,6 +1230,9 @@ field_A2I(void)
 	{
 	code_ptr[-2].op = F_PUSHI ;
 	code_ptr -> op = field_addr_to_index( code_ptr[-1].ptr ) ;
+	/* so that split_field0_to() splits only as far as needed */
+	if ( code_ptr -> op > max_field_read )
+	    max_field_read = code_ptr -> op ;
 	code_ptr++ ;
 	}
     }
@@ -1407,7 +1417,7 @@ parse(void)
    if ( compile_error_count != 0 ) mawk_exit(2) ;
    if ( dump_code_flag ) { dump_code() ; mawk_exit(0) ; }
 }
-#line 1410 "y.tab.c"
+#line 1420 "y.tab.c"
 
 #if YYDEBUG
 #include <stdio.h>		/* needed for printf */
@@ -2396,7 +2406,15 @@ case 135:
         }
 break;
 case 136:
-#line 884 "parse.y"
+#line 881 "parse.y"
+	{ yyval.start = yystack.l_mark[-5].start ;
+          check_array(yystack.l_mark[-1].stp) ;
+          code_array(yystack.l_mark[-1].stp) ;
+          code2(_BUILTIN, bi_match3) ;
+        }
+break;
+case 137:
+#line 890 "parse.y"
 	{
                INST *p1 = CDP(yystack.l_mark[0].start) ;
 
@@ -2417,26 +2435,26 @@ case 136:
                }
              }
 break;
-case 137:
-#line 908 "parse.y"
+case 138:
+#line 914 "parse.y"
 	{ yyval.start = code_offset ;
                       code1(_EXIT0) ; }
 break;
-case 138:
-#line 911 "parse.y"
+case 139:
+#line 917 "parse.y"
 	{ yyval.start = yystack.l_mark[-1].start ; code1(_EXIT) ; }
 break;
-case 139:
-#line 915 "parse.y"
+case 140:
+#line 921 "parse.y"
 	{ yyval.start = code_offset ;
                       code1(_RET0) ; }
 break;
-case 140:
-#line 918 "parse.y"
-	{ yyval.start = yystack.l_mark[-1].start ; code1(_RET) ; }
-break;
 case 141:
 #line 924 "parse.y"
+	{ yyval.start = yystack.l_mark[-1].start ; code1(_RET) ; }
+break;
+case 142:
+#line 930 "parse.y"
 	{ yyval.start = code_offset ;
             code2(F_PUSHA, &field[0]) ;
             code1(_PUSHINT) ; code1(0) ;
@@ -2444,51 +2462,51 @@ case 141:
             getline_flag = 0 ;
           }
 break;
-case 142:
-#line 931 "parse.y"
+case 143:
+#line 937 "parse.y"
 	{ yyval.start = yystack.l_mark[0].start ;
             code1(_PUSHINT) ; code1(0) ;
             code2(_BUILTIN, bi_getline) ;
             getline_flag = 0 ;
           }
 break;
-case 143:
-#line 937 "parse.y"
+case 144:
+#line 943 "parse.y"
 	{ code1(_PUSHINT) ; code1(F_IN) ;
             code2(_BUILTIN, bi_getline) ;
             /* getline_flag already off in yylex() */
           }
 break;
-case 144:
-#line 942 "parse.y"
+case 145:
+#line 948 "parse.y"
 	{ code2(F_PUSHA, &field[0]) ;
             code1(_PUSHINT) ; code1(PIPE_IN) ;
             code2(_BUILTIN, bi_getline) ;
           }
 break;
-case 145:
-#line 947 "parse.y"
+case 146:
+#line 953 "parse.y"
 	{
             code1(_PUSHINT) ; code1(PIPE_IN) ;
             code2(_BUILTIN, bi_getline) ;
           }
 break;
-case 146:
-#line 953 "parse.y"
+case 147:
+#line 959 "parse.y"
 	{ getline_flag = 1 ; }
 break;
-case 149:
-#line 958 "parse.y"
+case 150:
+#line 964 "parse.y"
 	{ yyval.start = code_offset ;
                    code2(F_PUSHA, field+0) ;
                  }
 break;
-case 150:
-#line 962 "parse.y"
+case 151:
+#line 968 "parse.y"
 	{ yyval.start = yystack.l_mark[-1].start ; }
 break;
-case 151:
-#line 970 "parse.y"
+case 152:
+#line 976 "parse.y"
 	{
              INST *p5 = CDP(yystack.l_mark[-1].start) ;
              INST *p6 = CDP(yystack.l_mark[0].start) ;
@@ -2507,34 +2525,34 @@ case 151:
              yyval.start = yystack.l_mark[-3].start ;
            }
 break;
-case 152:
-#line 989 "parse.y"
+case 153:
+#line 995 "parse.y"
 	{ yyval.fp = bi_sub ; }
 break;
-case 153:
-#line 990 "parse.y"
+case 154:
+#line 996 "parse.y"
 	{ yyval.fp = bi_gsub ; }
 break;
-case 154:
-#line 995 "parse.y"
+case 155:
+#line 1001 "parse.y"
 	{ yyval.start = code_offset ;
                   code2(F_PUSHA, &field[0]) ;
                 }
 break;
-case 155:
-#line 1000 "parse.y"
+case 156:
+#line 1006 "parse.y"
 	{ yyval.start = yystack.l_mark[-1].start ; }
 break;
-case 156:
-#line 1008 "parse.y"
+case 157:
+#line 1014 "parse.y"
 	{
                    resize_fblock(yystack.l_mark[-1].fbp) ;
                    restore_ids() ;
                    switch_code_to_main() ;
                  }
 break;
-case 157:
-#line 1017 "parse.y"
+case 158:
+#line 1023 "parse.y"
 	{ eat_nl() ;
                    scope = SCOPE_FUNCT ;
                    active_funct = yystack.l_mark[-3].fbp ;
@@ -2552,8 +2570,8 @@ case 157:
                    code_warn = code_limit - CODEWARN ;
                  }
 break;
-case 158:
-#line 1036 "parse.y"
+case 159:
+#line 1042 "parse.y"
 	{ FBLOCK  *fbp ;
 
                    if ( yystack.l_mark[0].stp->type == ST_NONE )
@@ -2576,27 +2594,27 @@ case 158:
                    yyval.fbp = fbp ;
                  }
 break;
-case 159:
-#line 1059 "parse.y"
+case 160:
+#line 1065 "parse.y"
 	{ yyval.fbp = yystack.l_mark[0].fbp ;
                    if ( yystack.l_mark[0].fbp->code )
                        compile_error("redefinition of %s" , yystack.l_mark[0].fbp->name) ;
                  }
 break;
-case 160:
-#line 1065 "parse.y"
+case 161:
+#line 1071 "parse.y"
 	{ yyval.ival = 0 ; }
 break;
-case 162:
-#line 1070 "parse.y"
+case 163:
+#line 1076 "parse.y"
 	{ yystack.l_mark[0].stp = save_id(yystack.l_mark[0].stp->name) ;
                 yystack.l_mark[0].stp->type = ST_LOCAL_NONE ;
                 yystack.l_mark[0].stp->offset = 0 ;
                 yyval.ival = 1 ;
               }
 break;
-case 163:
-#line 1076 "parse.y"
+case 164:
+#line 1082 "parse.y"
 	{ if ( is_local(yystack.l_mark[0].stp) )
                   compile_error("%s is duplicated in argument list",
                     yystack.l_mark[0].stp->name) ;
@@ -2608,8 +2626,8 @@ case 163:
                 }
               }
 break;
-case 164:
-#line 1089 "parse.y"
+case 165:
+#line 1095 "parse.y"
 	{  /* we may have to recover from a bungled function
                        definition */
                    /* can have local ids, before code scope
@@ -2619,8 +2637,8 @@ case 164:
                     switch_code_to_main() ;
                  }
 break;
-case 165:
-#line 1102 "parse.y"
+case 166:
+#line 1108 "parse.y"
 	{ yyval.start = yystack.l_mark[-1].start ;
              code2(_CALL, yystack.l_mark[-2].fbp) ;
 
@@ -2630,23 +2648,23 @@ case 165:
              check_fcall(yystack.l_mark[-2].fbp, scope, code_move_level, active_funct, yystack.l_mark[0].ca_p) ;
            }
 break;
-case 166:
-#line 1113 "parse.y"
+case 167:
+#line 1119 "parse.y"
 	{ yyval.ca_p = (CA_REC *) 0 ; }
 break;
-case 167:
-#line 1115 "parse.y"
+case 168:
+#line 1121 "parse.y"
 	{ yyval.ca_p = yystack.l_mark[0].ca_p ;
                  yyval.ca_p->link = yystack.l_mark[-1].ca_p ;
                  yyval.ca_p->arg_num = (short) (yystack.l_mark[-1].ca_p ? yystack.l_mark[-1].ca_p->arg_num+1 : 0) ;
                }
 break;
-case 168:
-#line 1130 "parse.y"
+case 169:
+#line 1136 "parse.y"
 	{ yyval.ca_p = (CA_REC *) 0 ; }
 break;
-case 169:
-#line 1132 "parse.y"
+case 170:
+#line 1138 "parse.y"
 	{ yyval.ca_p = ZMALLOC(CA_REC) ;
                 yyval.ca_p->link = yystack.l_mark[-2].ca_p ;
                 yyval.ca_p->type = CA_EXPR  ;
@@ -2654,8 +2672,8 @@ case 169:
                 yyval.ca_p->call_offset = code_offset ;
               }
 break;
-case 170:
-#line 1139 "parse.y"
+case 171:
+#line 1145 "parse.y"
 	{ yyval.ca_p = ZMALLOC(CA_REC) ;
                 yyval.ca_p->type = ST_NONE ;
                 yyval.ca_p->link = yystack.l_mark[-2].ca_p ;
@@ -2664,21 +2682,21 @@ case 170:
                 code_call_id(yyval.ca_p, yystack.l_mark[-1].stp) ;
               }
 break;
-case 171:
-#line 1149 "parse.y"
+case 172:
+#line 1155 "parse.y"
 	{ yyval.ca_p = ZMALLOC(CA_REC) ;
                 yyval.ca_p->type = CA_EXPR ;
                 yyval.ca_p->call_offset = code_offset ;
               }
 break;
-case 172:
-#line 1155 "parse.y"
+case 173:
+#line 1161 "parse.y"
 	{ yyval.ca_p = ZMALLOC(CA_REC) ;
                 yyval.ca_p->type = ST_NONE ;
                 code_call_id(yyval.ca_p, yystack.l_mark[-1].stp) ;
               }
 break;
-#line 2681 "y.tab.c"
+#line 2699 "y.tab.c"
     }
     yystack.s_mark -= yym;
     yystate = *yystack.s_mark;
@@ -877,6 +877,12 @@ p_expr : MATCH_FUNC LPAREN expr COMMA re_arg RPAREN
         { $$ = $3 ;
           code2(_BUILTIN, bi_match) ;
         }
+     |  MATCH_FUNC LPAREN expr COMMA re_arg COMMA ID RPAREN
+        { $$ = $3 ;
+          check_array($7) ;
+          code_array($7) ;
+          code2(_BUILTIN, bi_match3) ;
+        }
      ;
 
 
@@ -1213,6 +1219,9 @@ field_A2I(void)
 	{
 	code_ptr[-2].op = F_PUSHI ;
 	code_ptr -> op = field_addr_to_index( code_ptr[-1].ptr ) ;
+	/* so that split_field0_to() splits only as far as needed */
+	if ( code_ptr -> op > max_field_read )
+	    max_field_read = code_ptr -> op ;
 	code_ptr++ ;
 	}
     }
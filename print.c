@@ -75,6 +75,156 @@ the GNU General Public License, version 2, 1991.
 
 static void write_error(void);
 
+#if USE_PASSTHRU
+#include <sys/uio.h>
+#include <limits.h>
+
+/*
+ * Filters such as "/ERROR/" print most records unchanged.  If $0 is still
+ * the STRING made from a record of a mapped file, and ORS follows that
+ * record in the file, print writes the record and its separator straight
+ * from the mapping.  Adjacent records are merged into one range, and the
+ * ranges are written with writev() a batch at a time, bypassing the copy
+ * into stdio's buffer.
+ *
+ * Anything else which writes or flushes stdout calls passthru_flush()
+ * first, to keep the output in order.  None of this is done if stdout is
+ * a terminal, which stdio line buffers.
+ */
+#if defined(IOV_MAX) && IOV_MAX < 256
+#define PASS_IOVS	IOV_MAX
+#else
+#define PASS_IOVS	256
+#endif
+#define PASS_LIMIT	(64 * BUFFSZ)	/* bytes to batch before writing */
+
+static struct {
+    STRING *sval;		/* $0, with a reference held */
+    char *src;			/* where $0 was found in the mapping */
+    char *end;			/* end of the mapping */
+} pass_rec;
+
+static struct iovec pass_iov[PASS_IOVS];
+static int pass_iovcnt;
+static size_t pass_bytes;
+static int pass_ok = -1;	/* stdout is not a terminal */
+
+/* $0 was just set from [src, src + len) of a mapping ending at end */
+void
+passthru_record(char *src, char *end)
+{
+    if (pass_rec.sval != 0)
+	free_STRING(pass_rec.sval);
+    pass_rec.sval = string(field);
+    pass_rec.sval->ref_cnt++;
+    pass_rec.src = src;
+    pass_rec.end = end;
+}
+
+void
+passthru_flush(void)
+{
+    struct iovec *iov = pass_iov;
+    int cnt = pass_iovcnt;
+
+    if (cnt == 0)
+	return;
+    pass_iovcnt = 0;
+    pass_bytes = 0;
+
+    while (cnt > 0) {
+	ssize_t wrote = writev(fileno(stdout), iov, cnt);
+
+	if (wrote < 0) {
+	    if (errno == EINTR)
+		continue;
+	    write_error();
+	}
+	while (cnt > 0 && (size_t) wrote >= iov->iov_len) {
+	    wrote -= (ssize_t) iov->iov_len;
+	    ++iov;
+	    --cnt;
+	}
+	if (cnt > 0) {
+	    iov->iov_base = (char *) iov->iov_base + wrote;
+	    iov->iov_len -= (size_t) wrote;
+	}
+    }
+}
+
+/* the mapping [base, base + size) is going away */
+void
+passthru_unmap(char *base, size_t size)
+{
+    passthru_flush();
+    if (pass_rec.sval != 0 && pass_rec.src >= base && pass_rec.src < base + size) {
+	free_STRING(pass_rec.sval);
+	pass_rec.sval = 0;
+    }
+}
+
+/* true if printing cp and ORS to stdout was done from the mapping */
+static int
+passthru_print(CELL * cp)
+{
+    STRING *ors;
+    size_t len;
+    char *src;
+
+    if (pass_ok < 0)
+	pass_ok = !isatty(fileno(stdout));
+
+    if (!pass_ok
+	|| pass_rec.sval == 0
+	|| cp->type < C_STRING
+	|| string(cp) != pass_rec.sval
+	|| ORS->type < C_STRING) {
+	return 0;
+    }
+
+    ors = string(ORS);
+    len = pass_rec.sval->len;
+    src = pass_rec.src;
+    if ((size_t) (pass_rec.end - src) - len < ors->len
+	|| memcmp(src + len, ors->str, ors->len)) {
+	return 0;
+    }
+    len += ors->len;
+
+    if (pass_iovcnt != 0
+	&& (char *) pass_iov[pass_iovcnt - 1].iov_base
+	+ pass_iov[pass_iovcnt - 1].iov_len == src) {
+	pass_iov[pass_iovcnt - 1].iov_len += len;
+    } else {
+	if (pass_iovcnt == PASS_IOVS)
+	    passthru_flush();
+	if (pass_iovcnt == 0 && fflush(stdout) != 0)
+	    write_error();
+	pass_iov[pass_iovcnt].iov_base = src;
+	pass_iov[pass_iovcnt].iov_len = len;
+	++pass_iovcnt;
+    }
+    if ((pass_bytes += len) >= PASS_LIMIT)
+	passthru_flush();
+    return 1;
+}
+#else
+void
+passthru_record(char *src GCC_UNUSED, char *end GCC_UNUSED)
+{
+}
+
+void
+passthru_flush(void)
+{
+}
+
+void
+passthru_unmap(char *base GCC_UNUSED, size_t size GCC_UNUSED)
+{
+}
+#endif /* USE_PASSTHRU */
+
 /* this can be moved and enlarged  by -W sprintf=num  */
 char *sprintf_buff = string_buff;
 char *sprintf_limit = string_buff + SPRINTF_SZ;
@@ -152,6 +302,17 @@ bi_print(
     } else
 	fp = stdout;
 
+#if USE_PASSTHRU
+    if (fp == stdout) {
+	if (k <= 1 && passthru_print(k ? sp - 1 : field)) {
+	    if (k)
+		cell_destroy(sp - 1);
+	    return sp - 1 - k;
+	}
+	passthru_flush();
+    }
+#endif
+
     if (k) {
 	p = sp - k;		/* clear k variables off the stack */
 	sp = p - 1;
@@ -766,6 +927,9 @@ bi_printf(CELL * sp)
     } else
 	fp = stdout;
 
+    if (fp == stdout)
+	passthru_flush();
+
     sp -= k;			/* sp points at the format string */
     k--;
 
@@ -47,54 +47,300 @@ the GNU General Public License, version 2, 1991.
 #include "regexp.h"
 #include "repl.h"
 
+#ifdef HAVE_GETTIMEOFDAY
+#include <sys/time.h>
+#elif !defined(NO_TIME_H)
+#include <time.h>
+#endif
+
+/*
+ * For -W re_profile, what each regular expression has cost.  These are
+ * kept by the text of the expression, apart from the cache, so that one
+ * which is evicted and compiled again goes on adding to the same counts.
+ */
+typedef struct re_prof {
+    struct re_prof *link;	/* next in the same hash bucket */
+    STRING *sval;
+    unsigned hval;
+    unsigned long compiles;
+    unsigned long calls[RE_USES];
+    unsigned long bytes;	/* the lengths of the strings searched */
+    unsigned long pushes;	/* states saved for backtracking */
+    double seconds;		/* compiling and matching */
+} RE_PROF;
+
 typedef struct re_node {
     RE_DATA re;			/* keep this first, for re_destroy() */
     STRING *sval;
-    struct re_node *link;
+    struct re_node *link;	/* next in the same hash bucket */
+    struct re_node *newer;	/* the list, most recently used first */
+    struct re_node *older;
+    unsigned hval;
+    size_t size;		/* counted against re_cache_bytes */
+    int pinned;			/* never evicted */
+    RE_PROF *prof;		/* for -W re_profile */
 } RE_NODE;
 
-/* a list of compiled regular expressions */
-static RE_NODE *re_list;
+/*
+ * The compiled regular expressions, hashed on their strings, and kept in
+ * a list from the most to the least recently used.  Those compiled while
+ * parsing, and those which FS or RS use, are pinned, since the code and
+ * the separators point to them.  Any other is a dynamic regular expression,
+ * used only until the instruction which compiled it is done, and the least
+ * recently used of those are freed to keep within the limits set by
+ * -W re_cache and -W re_memory.
+ */
+static RE_NODE **re_table;
+static unsigned re_hmask;	/* the number of buckets, less one */
+static RE_NODE *re_newest;
+static RE_NODE *re_oldest;
+static unsigned re_nodes;
+static size_t re_entries;	/* dynamic ones only */
+static size_t re_bytes;
+
+size_t re_cache_entries = 1024;	/* -W re_cache */
+size_t re_cache_bytes = 16 * 1024 * 1024;	/* -W re_memory */
+int re_stats_flag;		/* -W re_stats */
+int re_profile_flag;		/* -W re_profile */
+
+static struct {
+    unsigned long hits;
+    unsigned long misses;
+    unsigned long evicted;
+    size_t most;		/* the most dynamic entries at once */
+} re_stats;
 
 static char efmt[] = "regular expression compile failed (%s)\n%s";
 
+/*
+ * The time for -W re_profile, in seconds.  gettimeofday() costs much less
+ * than clock() on most systems, which matters when a matcher is called for
+ * every record.
+ */
+static double
+prof_clock(void)
+{
+#if defined(HAVE_GETTIMEOFDAY)
+    struct timeval tv;
+
+    gettimeofday(&tv, (struct timezone *) 0);
+    return (double) tv.tv_sec + (double) tv.tv_usec / 1e6;
+#elif !defined(NO_TIME_H)
+    return (double) clock() / CLOCKS_PER_SEC;
+#else
+    return 0.0;
+#endif
+}
+
+static RE_PROF **prof_table;
+static unsigned prof_hmask;
+static unsigned prof_count;
+static RE_PROF rule_prof;	/* the passes of re_rule_test() */
+
+static void
+re_unlink(RE_NODE * p)
+{
+    if (p->newer)
+	p->newer->older = p->older;
+    else
+	re_newest = p->older;
+    if (p->older)
+	p->older->newer = p->newer;
+    else
+	re_oldest = p->newer;
+}
+
+static void
+re_to_front(RE_NODE * p)
+{
+    p->newer = 0;
+    p->older = re_newest;
+    if (re_newest)
+	re_newest->newer = p;
+    else
+	re_oldest = p;
+    re_newest = p;
+}
+
+/* remove p from the table and the list, and free it */
+static void
+re_free_node(RE_NODE * p)
+{
+    RE_NODE **q = &re_table[p->hval & re_hmask];
+
+    while (*q != p)
+	q = &(*q)->link;
+    *q = p->link;
+    re_unlink(p);
+    re_nodes--;
+    if (!p->pinned) {
+	re_entries--;
+	re_bytes -= p->size;
+    }
+    free_STRING(p->sval);
+    REdestroy(p->re.compiled);
+    if (p->re.groups)
+	REgroups_destroy(p->re.groups);
+    ZFREE(p);
+}
+
+/* double the number of buckets */
+static void
+re_grow(void)
+{
+    unsigned old_size = re_table ? re_hmask + 1 : 0;
+    unsigned new_size = old_size ? 2 * old_size : 64;
+    RE_NODE **table = (RE_NODE **) zmalloc(new_size * sizeof(RE_NODE *));
+    RE_NODE *p;
+
+    memset(table, 0, new_size * sizeof(RE_NODE *));
+    re_hmask = new_size - 1;
+    for (p = re_newest; p; p = p->older) {
+	p->link = table[p->hval & re_hmask];
+	table[p->hval & re_hmask] = p;
+    }
+    if (re_table)
+	zfree(re_table, old_size * sizeof(RE_NODE *));
+    re_table = table;
+}
+
+/* double the number of buckets of prof_table */
+static void
+re_prof_grow(void)
+{
+    unsigned old_size = prof_table ? prof_hmask + 1 : 0;
+    unsigned new_size = old_size ? 2 * old_size : 64;
+    RE_PROF **table = (RE_PROF **) zmalloc(new_size * sizeof(RE_PROF *));
+    unsigned n;
+
+    memset(table, 0, new_size * sizeof(RE_PROF *));
+    prof_hmask = new_size - 1;
+    for (n = 0; n < old_size; ++n) {
+	RE_PROF *q = prof_table[n];
+
+	while (q != 0) {
+	    RE_PROF *next = q->link;
+
+	    q->link = table[q->hval & prof_hmask];
+	    table[q->hval & prof_hmask] = q;
+	    q = next;
+	}
+    }
+    if (prof_table)
+	zfree(prof_table, old_size * sizeof(RE_PROF *));
+    prof_table = table;
+}
+
+/* the RE_PROF for the text sval, whose hash is h */
+static RE_PROF *
+re_prof_find(STRING * sval, unsigned h)
+{
+    RE_PROF *q;
+
+    if (prof_table) {
+	for (q = prof_table[h & prof_hmask]; q; q = q->link) {
+	    if (q->hval == h
+		&& sval->len == q->sval->len
+		&& memcmp(sval->str, q->sval->str, sval->len) == 0)
+		return q;
+	}
+    }
+    if (prof_table == 0 || prof_count / 2 > prof_hmask)
+	re_prof_grow();
+    q = ZMALLOC(RE_PROF);
+    memset(q, 0, sizeof(RE_PROF));
+    q->sval = sval;
+    sval->ref_cnt++;
+    q->hval = h;
+    q->link = prof_table[h & prof_hmask];
+    prof_table[h & prof_hmask] = q;
+    prof_count++;
+    return q;
+}
+
+/*
+ * Evict the least recently used dynamic regular expressions, other than
+ * keep, until those left are within the limits.
+ */
+static void
+re_evict(RE_NODE * keep)
+{
+    RE_NODE *p = re_oldest;
+
+    while (p != 0
+	   && (re_entries > re_cache_entries || re_bytes > re_cache_bytes)) {
+	RE_NODE *q = p->newer;
+
+	if (!p->pinned && p != keep) {
+	    TRACE(("re_evict %s\n", p->sval->str));
+	    re_free_node(p);
+	    re_stats.evicted++;
+	}
+	p = q;
+    }
+}
+
+/*
+ * The DFA of a machine grows as it is used, so the size of the newest
+ * entry is taken again when another one takes its place.
+ */
+static void
+re_resize(RE_NODE * p)
+{
+    size_t size = sizeof(RE_NODE) + p->sval->len + REsize(p->re.compiled);
+
+    if (!p->pinned)
+	re_bytes = re_bytes - p->size + size;
+    p->size = size;
+}
+
 /* compile a STRING to a regular expression machine.
-   Search a list of pre-compiled strings first
+   Search the table of pre-compiled strings first
 */
 PTR
 re_compile(STRING * sval)
 {
     register RE_NODE *p;
-    RE_NODE *q;
-    char *s;
-
-    /* search list */
-    s = sval->str;
-    p = re_list;
-    q = (RE_NODE *) 0;
+    char *s = sval->str;
+    unsigned h;
+    double start = 0.0;
+
+    /* the string used last time, e.g., from a variable, is not hashed,
+       since that takes as long as the pattern, such as a list of words */
+    if ((p = re_newest) != 0 && p->sval == sval) {
+	re_stats.hits++;
+	goto _return;
+    }
 
-    while (p) {
-	if (sval->len == p->sval->len
-	    && memcmp(s, p->sval->str, sval->len) == 0) {
-	    /* found */
-	    if (!q)		/* already at front */
+    h = hash2(s, sval->len);
+    if (re_table) {
+	for (p = re_table[h & re_hmask]; p; p = p->link) {
+	    if (p->hval == h
+		&& sval->len == p->sval->len
+		&& memcmp(s, p->sval->str, sval->len) == 0) {
+		re_stats.hits++;
+		if (p != re_newest) {
+		    re_resize(re_newest);
+		    re_unlink(p);
+		    re_to_front(p);
+		    if (re_bytes > re_cache_bytes)
+			re_evict(p);
+		}
 		goto _return;
-	    else {		/* delete from list for move to front */
-		q->link = p->link;
-		goto found;
 	    }
-	} else {
-	    q = p;
-	    p = p->link;
 	}
     }
 
     /* not found */
+    re_stats.misses++;
+    if (re_profile_flag)
+	start = prof_clock();
     p = ZMALLOC(RE_NODE);
     p->sval = sval;
 
     sval->ref_cnt++;
     p->re.anchored = (*s == '^');
+    p->re.groups = 0;
     if (!(p->re.compiled = REcompile(s, sval->len))) {
 	ZFREE(p);
 	sval->ref_cnt--;
@@ -105,11 +351,33 @@ re_compile(STRING * sval)
 	    return (PTR) 0;
 	}
     }
-
-  found:
-    /* insert p at the front of the list */
-    p->link = re_list;
-    re_list = p;
+    p->hval = h;
+    p->prof = 0;
+    if (re_profile_flag) {
+	p->prof = re_prof_find(sval, h);
+	p->prof->compiles++;
+	p->prof->seconds += prof_clock() - start;
+    }
+    p->size = sizeof(RE_NODE) + sval->len + REsize(p->re.compiled);
+    p->pinned = (mawk_state != EXECUTION);
+
+    if (re_table == 0 || re_nodes / 2 > re_hmask)
+	re_grow();
+    re_nodes++;
+    p->link = re_table[h & re_hmask];
+    re_table[h & re_hmask] = p;
+    if (re_newest)
+	re_resize(re_newest);
+    re_to_front(p);
+
+    if (!p->pinned) {
+	re_entries++;
+	re_bytes += p->size;
+	if (re_entries > re_cache_entries || re_bytes > re_cache_bytes)
+	    re_evict(p);
+	if (re_entries > re_stats.most)
+	    re_stats.most = re_entries;
+    }
 
   _return:
 
@@ -120,6 +388,273 @@ re_compile(STRING * sval)
     return refRE_DATA(p->re);
 }
 
+/* keep a regular expression which FS or RS uses */
+void
+re_pin(PTR m)
+{
+    RE_NODE *p = (RE_NODE *) m;
+
+    if (!p->pinned) {
+	p->pinned = 1;
+	re_entries--;
+	re_bytes -= p->size;
+    }
+}
+
+/* for -W re_stats */
+void
+re_report(void)
+{
+    fprintf(stderr,
+	    "regular expression cache: %lu hits, %lu misses, %lu evicted, "
+	    "%lu kept at most\n",
+	    re_stats.hits, re_stats.misses, re_stats.evicted,
+	    (unsigned long) re_stats.most);
+}
+
+/*
+ * For -W re_profile, the matchers are called through these, see re_test(),
+ * etc.  The bytes counted are those given to the matcher, which may stop
+ * short of them.
+ */
+static void
+re_prof_add(RE_PROF * q, int use, size_t len, unsigned long pushes,
+	    double start)
+{
+    q->seconds += prof_clock() - start;
+    q->calls[use]++;
+    q->bytes += (unsigned long) len;
+    q->pushes += RE_pushes - pushes;
+}
+
+int
+re_prof_test(PTR re, char *str, size_t len)
+{
+    unsigned long pushes = RE_pushes;
+    double start = prof_clock();
+    int result = REtest(str, len, cast_to_re(re));
+
+    re_prof_add(((RE_NODE *) re)->prof, RE_TEST, len, pushes, start);
+    return result;
+}
+
+char *
+re_prof_match(PTR re, int use, char *str, size_t len, size_t *lenp)
+{
+    unsigned long pushes = RE_pushes;
+    double start = prof_clock();
+    char *result = REmatch(str, len, cast_to_re(re), lenp);
+
+    re_prof_add(((RE_NODE *) re)->prof, use, len, pushes, start);
+    return result;
+}
+
+char *
+re_prof_resume(PTR re, int use, char *str, size_t len, size_t *lenp,
+	       char *from, char **partp)
+{
+    unsigned long pushes = RE_pushes;
+    double start = prof_clock();
+    char *result = REmatch_resume(str, len, cast_to_re(re), lenp, from, partp);
+
+    re_prof_add(((RE_NODE *) re)->prof, use, (size_t) (str + len - from),
+		pushes, start);
+    return result;
+}
+
+/*
+ * gsub() of a single string searches for it with str_str() rather than
+ * calling the matchers, see gsub_literal().  Charge its searches, one per
+ * match and one which fails, as matches.
+ */
+double
+re_prof_start(void)
+{
+    return prof_clock();
+}
+
+void
+re_prof_literal(PTR re, unsigned matches, size_t len, double start)
+{
+    RE_PROF *q = ((RE_NODE *) re)->prof;
+
+    re_prof_add(q, RE_MATCH, len, RE_pushes, start);
+    q->calls[RE_MATCH] += matches;
+}
+
+/*
+ * The patterns of the main block which test $0 against a regular
+ * expression, e.g., "/foo/ { ... }", are coded as _MATCH0S.  The first of
+ * those tested on a record tests all of them, in one pass over it, and the
+ * rest look up their results.  Since rule_key holds a reference to the
+ * record, it cannot be reused for another while the results are kept.
+ */
+static RE_RULE *rule_list;	/* operands of the _MATCH0S */
+static int rule_count;
+static PTR rule_set;		/* from REset() */
+static char *rule_results;	/* for rule_key */
+static STRING *rule_key;	/* the $0 which was tested */
+static int rule_direct;		/* ...one rule at a time */
+
+/*
+ * Given the RE's of the patterns which test $0 in the main block, make a
+ * set of those which can be tested together.  Replace each of those in
+ * list[] with the RE_RULE to use as the operand of _MATCH0S.
+ */
+void
+re_rules(PTR * list, int count)
+{
+    PTR *machines = (PTR *) zmalloc((size_t) count * sizeof(PTR));
+    int n;
+
+    for (n = 0; n < count; ++n)
+	machines[n] = cast_to_re(list[n]);
+
+    if ((rule_set = REset(machines, count)) != 0) {
+	rule_count = count;
+	rule_list = (RE_RULE *) zmalloc((size_t) count * sizeof(RE_RULE));
+	rule_results = (char *) zmalloc((size_t) count);
+	for (n = 0; n < count; ++n) {
+	    rule_list[n].re = list[n];
+	    rule_list[n].index = n;
+	    rule_list[n].last = n;
+	    rule_list[n].fail = 0;
+	    if (machines[n] != 0)
+		list[n] = (PTR) & rule_list[n];
+	}
+    }
+    zfree(machines, (size_t) count * sizeof(PTR));
+}
+
+/* does sval, which is $0, match the RE of an RE_RULE? */
+int
+re_rule_test(PTR rule, STRING * sval)
+{
+    RE_RULE *p = (RE_RULE *) rule;
+
+    if (sval != rule_key) {
+	if (rule_key != 0)
+	    free_STRING(rule_key);
+	rule_key = sval;
+	sval->ref_cnt++;
+	if (re_profile_flag) {
+	    unsigned long pushes = RE_pushes;
+	    double start = prof_clock();
+
+	    rule_direct = (REset_test(rule_set, sval->str, sval->len,
+				      rule_results) < 0);
+	    re_prof_add(&rule_prof, RE_TEST, sval->len, pushes, start);
+	} else {
+	    rule_direct = (REset_test(rule_set, sval->str, sval->len,
+				      rule_results) < 0);
+	}
+    }
+    if (rule_direct)
+	return re_test(p->re, sval->str, sval->len);
+    return rule_results[p->index];
+}
+
+/*
+ * The pattern of an RE_RULE did not match $0.  Skip its _JZ, and the
+ * patterns of the rules after it which also do not match, returning where
+ * the last of those jumps.
+ */
+INST *
+re_rule_skip(RE_RULE * p)
+{
+    if (!rule_direct && p->last != p->index) {
+	char *hit = memchr(rule_results + p->index + 1, 1,
+			   (size_t) (p->last - p->index));
+
+	p = rule_list + (hit ? (int) (hit - rule_results) - 1 : p->last);
+    }
+    return p->fail;
+}
+
+#define prof_calls(q) \
+	((q)->calls[RE_TEST] + (q)->calls[RE_MATCH] + (q)->calls[RE_SPLIT])
+
+/* most time first, then most calls */
+static int
+re_prof_compare(const void *a, const void *b)
+{
+    const RE_PROF *p = *(const RE_PROF * const *) a;
+    const RE_PROF *q = *(const RE_PROF * const *) b;
+
+    if (p->seconds != q->seconds)
+	return (p->seconds < q->seconds) ? 1 : -1;
+    if (prof_calls(p) != prof_calls(q))
+	return (prof_calls(p) < prof_calls(q)) ? 1 : -1;
+    return 0;
+}
+
+#define PROF_TEXT	60	/* longer expressions are cut short */
+
+static void
+re_prof_line(RE_PROF * q)
+{
+    fprintf(stderr, "%9.1f %9lu %9lu %9lu %12lu %10lu %8lu  ",
+	    q->seconds * 1000.0,
+	    q->calls[RE_TEST], q->calls[RE_MATCH], q->calls[RE_SPLIT],
+	    q->bytes, q->pushes, q->compiles);
+    if (q->sval == 0) {
+	fprintf(stderr, "(%d patterns tested together)\n", rule_count);
+    } else if (q->sval->len > PROF_TEXT) {
+	da_string(stderr, q->sval->str, (size_t) PROF_TEXT);
+	fprintf(stderr, "...\n");
+    } else {
+	da_string(stderr, q->sval->str, q->sval->len);
+	fputc('\n', stderr);
+    }
+}
+
+/*
+ * For -W re_profile, a line per regular expression, most time first.  The
+ * headings begin with "#", and the expression is last, so that the lines
+ * can be sorted on any other column with sort -k.
+ */
+void
+re_prof_report(void)
+{
+    RE_PROF **list;
+    unsigned count = 0;
+    unsigned n;
+
+    list = (RE_PROF **) zmalloc((prof_count + 1) * sizeof(RE_PROF *));
+    for (n = 0; prof_table != 0 && n <= prof_hmask; ++n) {
+	RE_PROF *q;
+
+	for (q = prof_table[n]; q; q = q->link)
+	    list[count++] = q;
+    }
+    if (rule_prof.calls[RE_TEST])
+	list[count++] = &rule_prof;
+    qsort(list, (size_t) count, sizeof(RE_PROF *), re_prof_compare);
+
+    fprintf(stderr, "# regular expression profile, most time first\n");
+    fprintf(stderr, "# %7s %9s %9s %9s %12s %10s %8s  %s\n",
+	    "msec", "tests", "matches", "splits",
+	    "bytes", "pushes", "compiles", "expression");
+    for (n = 0; n < count; ++n)
+	re_prof_line(list[n]);
+    zfree(list, (prof_count + 1) * sizeof(RE_PROF *));
+}
+
+/*
+ * The machine which finds the groups of a regular expression, compiled
+ * the first time match(s, r, a) uses it.
+ */
+PTR
+re_groups(PTR m)
+{
+    RE_NODE *p = (RE_NODE *) m;
+
+    if (p->re.groups == 0
+	&& (p->re.groups = REgroups(p->sval->str, p->sval->len)) == 0)
+	rt_error(efmt, REerror(), p->sval->str);
+    return p->re.groups;
+}
+
 /* this is only used by da() */
 
 char *
@@ -127,7 +662,7 @@ re_uncompile(PTR m)
 {
     register RE_NODE *p;
 
-    for (p = re_list; p; p = p->link)
+    for (p = re_newest; p; p = p->older)
 	if (p->re.compiled == cast_to_re(m))
 	    return p->sval->str;
 #ifdef DEBUG
@@ -142,18 +677,11 @@ re_destroy(PTR m)
 {
     RE_NODE *p = (RE_NODE *) m;
     RE_NODE *q;
-    RE_NODE *r;
 
     if (p != 0) {
-	for (q = re_list, r = 0; q != 0; r = q, q = q->link) {
+	for (q = re_newest; q != 0; q = q->older) {
 	    if (q == p) {
-		free_STRING(p->sval);
-		REdestroy(p->re.compiled);
-		if (r != 0)
-		    r->link = q->link;
-		else
-		    re_list = q->link;
-		free(q);
+		re_free_node(q);
 		break;
 	    }
 	}
@@ -447,12 +975,44 @@ no_leaks_re_ptr(PTR m)
 void
 re_leaks(void)
 {
+    if (rule_set != 0) {
+	REset_destroy(rule_set);
+	rule_set = 0;
+	zfree(rule_list, (size_t) rule_count * sizeof(RE_RULE));
+	zfree(rule_results, (size_t) rule_count);
+    }
+    if (rule_key != 0) {
+	free_STRING(rule_key);
+	rule_key = 0;
+    }
+
     while (all_ptrs != 0) {
 	ALL_PTRS *next = all_ptrs->next;
 	re_destroy(all_ptrs->m);
 	free(all_ptrs);
 	all_ptrs = next;
     }
+    while (re_newest != 0)
+	re_free_node(re_newest);
+    if (prof_table != 0) {
+	unsigned n;
+
+	for (n = 0; n <= prof_hmask; ++n) {
+	    while (prof_table[n] != 0) {
+		RE_PROF *q = prof_table[n];
+
+		prof_table[n] = q->link;
+		free_STRING(q->sval);
+		ZFREE(q);
+	    }
+	}
+	zfree(prof_table, (prof_hmask + 1) * sizeof(RE_PROF *));
+	prof_table = 0;
+    }
+    if (re_table != 0) {
+	zfree(re_table, (re_hmask + 1) * sizeof(RE_NODE *));
+	re_table = 0;
+    }
 
     while (repl_list != 0) {
 	REPL_NODE *p = repl_list->link;
@@ -19,6 +19,11 @@ the GNU General Public License, version 2, 1991.
 #		include "rexp2.c"
 #		include "rexp3.c"
 #		include "rexp4.c"
+#		include "rexp5.c"
+#		include "rexp6.c"
+#		include "rexp7.c"
+#		include "rexp8.c"
+#		include "rexp9.c"
 #		include "rexpdb.c"
 #else
 #		include "rexp4.c"
@@ -32,16 +37,26 @@ rexp_leaks(void)
     TRACE(("rexp_leaks\n"));
 #ifdef LOCAL_REGEXP
     lookup_cclass(0);
-    if (bv_base) {
-	BV **p = bv_base;
-	while (p != bv_next) {
-	    RE_free(*p);
-	    ++p;
+    {
+	int n;
+	for (n = 0; n < BV_BUCKETS; ++n) {
+	    while (bv_table[n]) {
+		SCAN_BV *p = bv_table[n];
+		bv_table[n] = p->link;
+		RE_free(p);
+	    }
 	}
-	RE_free(bv_base);
-	bv_base = 0;
-	bv_limit = 0;
-	bv_next = 0;
+    }
+    if (bv_fresh) {
+	RE_free(bv_fresh);
+	bv_fresh = 0;
+	bv_fresh_count = 0;
+	bv_fresh_max = 0;
+    }
+    if (str_buff) {
+	RE_free(str_buff);
+	str_buff = 0;
+	str_size = 0;
     }
     if (RE_run_stack_base) {
 	RE_free(RE_run_stack_base);
@@ -51,6 +66,10 @@ rexp_leaks(void)
 	RE_free(RE_pos_stack_base);
 	RE_pos_stack_base = 0;
     }
+    RE_dfa_leaks();
+    RE_pike_leaks();
+    RE_groups_leaks();
+    RE_trie_leaks();
 #endif
 }
 #endif
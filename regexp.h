@@ -29,9 +29,23 @@ the GNU General Public License, version 2, 1991.
 
 PTR REcompile(char *, size_t);
 void REdestroy(PTR);
+size_t REsize(PTR);
 int REtest(char *, size_t, PTR);
 char *REmatch(char *, size_t, PTR, size_t *);
+char *REmatch_resume(char *, size_t, PTR, size_t *, char *, char **);
 void REmprint(PTR, FILE *);
 const char *REerror(void);
+PTR REset(PTR *, int);
+int REset_test(PTR, char *, size_t, char *);
+void REset_destroy(PTR);
+PTR REgroups(char *, size_t);
+int REgroups_count(PTR);
+void REgroups_match(PTR, char *, size_t, char *, size_t, char **, size_t *);
+void REgroups_destroy(PTR);
+
+extern int RE_backtrack;	/* see rexp7.c */
+extern unsigned long RE_pushes;	/* states saved when backtracking */
+extern int RE_fold;		/* -W ignorecase */
+extern int RE_jit_flag;		/* -W re_jit, see rexp5.c */
 
 #endif /*  MAWK_REPL_H */
@@ -18,6 +18,7 @@ the GNU General Public License, version 2, 1991.
 #include <regex.h>
 #include <string.h>
 #include <stdlib.h>
+#include <ctype.h>
 #include <errno.h>
 
 #include "regexp.h"
@@ -38,6 +39,28 @@ static int err_code = 0;
 #define IgnoreNull()    errmsg(-1, "ignoring embedded null in pattern")
 #define IgnoreEscaped() errmsg(-1, "ignoring escaped '%c' in pattern", ch)
 
+/* the length of {n}, {n,}, {n,m} or {,m} at s, else 0 */
+static size_t
+interval_length(const char *s, size_t left)
+{
+    size_t n = 1;
+
+    if (n >= left)
+	return 0;
+    if (s[n] == ',' && (n + 1 >= left || !isdigit((unsigned char) s[n + 1])))
+	return 0;
+    if (s[n] != ',' && !isdigit((unsigned char) s[n]))
+	return 0;
+    while (n < left && isdigit((unsigned char) s[n]))
+	++n;
+    if (n < left && s[n] == ',') {
+	++n;
+	while (n < left && isdigit((unsigned char) s[n]))
+	    ++n;
+    }
+    return (n < left && s[n] == '}') ? n + 1 : 0;
+}
+
 /*
  * Keep track, for octal and hex escapes:
  * octal: 2,3,4
@@ -58,6 +81,7 @@ prepare_regexp(char *regexp, const char *source, size_t limit)
     char ch;
     int value = 0;
     int added;
+    size_t n;
 
     TRACE(("in : \"%s\"\n", base));
 
@@ -268,6 +292,16 @@ prepare_regexp(char *regexp, const char *source, size_t limit)
 		    *tail++ = ch;
 		    break;
 		}
+		/* pass {n,m} to the library, unless it follows ( or | */
+		if (range == 0
+		    && tail[-1] != '(' && tail[-1] != '|'
+		    && (n = interval_length(source - 1,
+					    limit + 1 - (size_t) (source - base))) != 0) {
+		    memcpy(tail, source - 1, n);
+		    tail += n;
+		    source += n - 1;
+		    break;
+		}
 		/* FALLTHRU */
 	    case '}':
 		if (range == 0)
@@ -291,6 +325,14 @@ void *
 REcompile(char *regexp, size_t len)
 {
     mawk_re_t *re = (mawk_re_t *) malloc(sizeof(mawk_re_t));
+    int flags = REG_EXTENDED | (RE_fold ? REG_ICASE : 0);
+
+    /* (?i) at the start ignores case in this one */
+    if (len >= 4 && !memcmp(regexp, "(?i)", (size_t) 4)) {
+	regexp += 4;
+	len -= 4;
+	flags |= REG_ICASE;
+    }
 
     if (re != 0) {
 	size_t need = (len * 2) + 8;	/* might double, with escaping */
@@ -312,7 +354,7 @@ REcompile(char *regexp, size_t len)
 
 	    memset(re, 0, sizeof(mawk_re_t));
 	    re->regexp = strdup(new_regexp);
-	    err_code = regcomp(&re->re, new_regexp, REG_EXTENDED);
+	    err_code = regcomp(&re->re, new_regexp, flags);
 
 	    free(new_regexp);
 
@@ -331,7 +373,21 @@ REcompile(char *regexp, size_t len)
 void
 REdestroy(PTR ptr)
 {
-    (void) ptr;
+    mawk_re_t *re = (mawk_re_t *) ptr;
+
+    if (re == last_used_regexp)
+	last_used_regexp = NULL;
+    regfree(&re->re);
+    free(re->regexp);
+    free(re);
+}
+
+size_t
+REsize(PTR ptr)
+{
+    mawk_re_t *re = (mawk_re_t *) ptr;
+
+    return sizeof(mawk_re_t) + strlen(re->regexp) + 1;
 }
 
 /*
@@ -379,6 +435,128 @@ REmatch(char *str, size_t str_len GCC_UNUSED, PTR q, size_t *lenp)
     }
 }
 
+/*
+ * There is no way to find where a partial match begins, so callers which
+ * append text must search the whole string again.
+ */
+char *
+REmatch_resume(char *str, size_t str_len GCC_UNUSED, PTR q, size_t *lenp,
+	       char *from, char **partp)
+{
+    mawk_re_t *re = (mawk_re_t *) q;
+    regmatch_t match[MAX_MATCHES];
+
+    (void) str_len;		/* regexec() stops at the NUL */
+    TRACE(("REmatch_resume:  \"%s\" ~ /%s/", from, re->regexp));
+
+    last_used_regexp = re;
+    if (partp != 0)
+	*partp = str;
+
+    if (!regexec(&re->re, from, (size_t) MAX_MATCHES, match,
+		 (from != str) ? REG_NOTBOL : 0)) {
+	*lenp = (size_t) (match[0].rm_eo - match[0].rm_so);
+	TRACE(("=%i/%lu\n", match[0].rm_so, (unsigned long) *lenp));
+	return from + match[0].rm_so;
+    } else {
+	TRACE(("=0\n"));
+	return NULL;
+    }
+}
+
+/* -W re_linear is accepted, but the library decides how to match */
+int RE_backtrack;
+
+unsigned long RE_pushes;	/* the library does not count these */
+
+/* ...and -W re_jit, since there is no DFA to translate */
+int RE_jit_flag;
+
+int RE_fold;			/* -W ignorecase */
+
+/* there is no way to test a set of these together */
+PTR
+REset(PTR * machines, int count)
+{
+    (void) machines;
+    (void) count;
+    return 0;
+}
+
+int
+REset_test(PTR set, char *str, size_t len, char *result)
+{
+    (void) set;
+    (void) str;
+    (void) len;
+    (void) result;
+    return -1;
+}
+
+void
+REset_destroy(PTR set)
+{
+    (void) set;
+}
+
+/*
+ * The groups are those of the library, less the one REcompile() puts
+ * around the whole expression.
+ */
+PTR
+REgroups(char *re, size_t len)
+{
+    return REcompile(re, len);
+}
+
+int
+REgroups_count(PTR ptr)
+{
+    mawk_re_t *re = (mawk_re_t *) ptr;
+    int count = (int) re->re.re_nsub - 1;
+
+    if (count > MAX_MATCHES - 2)
+	count = MAX_MATCHES - 2;
+    return count;
+}
+
+void
+REgroups_match(PTR ptr,
+	       char *str,
+	       size_t str_len GCC_UNUSED,
+	       char *match,
+	       size_t match_len GCC_UNUSED,
+	       char **starts,
+	       size_t *lens)
+{
+    mawk_re_t *re = (mawk_re_t *) ptr;
+    regmatch_t found[MAX_MATCHES];
+    int count = REgroups_count(ptr);
+    int n;
+
+    (void) str_len;
+    (void) match_len;
+    last_used_regexp = re;
+    if (regexec(&re->re, match, (size_t) MAX_MATCHES, found,
+		(match != str) ? REG_NOTBOL : 0))
+	found[0].rm_so = -1;
+    for (n = 0; n < count; ++n) {
+	if (found[0].rm_so == 0 && found[n + 2].rm_so >= 0) {
+	    starts[n] = match + found[n + 2].rm_so;
+	    lens[n] = (size_t) (found[n + 2].rm_eo - found[n + 2].rm_so);
+	} else {
+	    starts[n] = 0;
+	    lens[n] = 0;
+	}
+    }
+}
+
+void
+REgroups_destroy(PTR ptr)
+{
+    REdestroy(ptr);
+}
+
 void
 REmprint(void *m, FILE *f)
 {
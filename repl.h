@@ -31,6 +31,7 @@ the GNU General Public License, version 2, 1991.
 typedef struct re_data {
     int anchored;		/* use to limit recursion in gsub */
     PTR compiled;
+    PTR groups;			/* for match(s, r, a), see re_groups() */
 } RE_DATA;
 
 /*
@@ -40,8 +41,61 @@ typedef struct re_data {
 #define cast_to_re(ptr) (((RE_DATA *)(ptr))->compiled)
 #define refRE_DATA(re)  ((PTR) &(re))
 
+/*
+ * The operand of _MATCH0S, see re_rules().
+ */
+typedef struct re_rule {
+    PTR re;			/* the RE_DATA, as for _MATCH0 */
+    int index;			/* in the set of rules */
+    int last;			/* the last rule tested if this one fails */
+    INST *fail;			/* where the pattern's _JZ goes, if any */
+} RE_RULE;
+
+#define rule_to_re(ptr) (((RE_RULE *)(ptr))->re)
+
+extern size_t re_cache_entries;	/* -W re_cache */
+extern size_t re_cache_bytes;	/* -W re_memory */
+extern int re_stats_flag;	/* -W re_stats */
+extern int re_profile_flag;	/* -W re_profile */
+
+/*
+ * The matchers, called through these so that -W re_profile can charge each
+ * call to its regular expression.  The caller includes regexp.h.
+ */
+#define RE_TEST		0	/* REtest() */
+#define RE_MATCH	1	/* REmatch() for match(), sub() and gsub() */
+#define RE_SPLIT	2	/* ...for split(), FS and RS */
+#define RE_USES		3
+
+#define re_test(re,s,len) \
+	(re_profile_flag \
+	 ? re_prof_test(re, s, len) \
+	 : REtest(s, len, cast_to_re(re)))
+
+#define re_match(re,use,s,len,lenp) \
+	(re_profile_flag \
+	 ? re_prof_match(re, use, s, len, lenp) \
+	 : REmatch(s, len, cast_to_re(re), lenp))
+
+#define re_match_resume(re,use,s,len,lenp,from,partp) \
+	(re_profile_flag \
+	 ? re_prof_resume(re, use, s, len, lenp, from, partp) \
+	 : REmatch_resume(s, len, cast_to_re(re), lenp, from, partp))
+
 PTR re_compile(STRING *);
+void re_pin(PTR);
+PTR re_groups(PTR);
+void re_report(void);
+int re_prof_test(PTR, char *, size_t);
+char *re_prof_match(PTR, int, char *, size_t, size_t *);
+char *re_prof_resume(PTR, int, char *, size_t, size_t *, char *, char **);
+double re_prof_start(void);
+void re_prof_literal(PTR, unsigned, size_t, double);
+void re_prof_report(void);
 char *re_uncompile(PTR);
+void re_rules(PTR *, int);
+int re_rule_test(PTR, STRING *);
+INST *re_rule_skip(RE_RULE *);
 
 CELL *repl_compile(STRING *);
 char *repl_uncompile(CELL *);
@@ -48,6 +48,7 @@ the GNU General Public License, version 2, 1991.
 
 #include "rexp.h"
 #include "regexp.h"
+#include <ctype.h>
 
 /*  DATA   */
 int REerrno;
@@ -58,27 +59,212 @@ const char *REerrlist[] =
  /* 3  */ "bad class -- [], [^] or [",
  /* 4  */ "missing operand",
  /* 5  */ "resource exhaustion -- regular expression too large",
- /* 6  */ "syntax error ^* or ^+"
+ /* 6  */ "syntax error ^* or ^+",
+ /* 7  */ "bad repetition count in {n,m}"
 };
 /* E5 is very unlikely to occur */
 
 /* This table drives the operator precedence parser */
 /* *INDENT-OFF* */
-static  short  table[8][8]  =  {
-/*        0   |   CAT   *   +   ?   (   )   */
-/* 0 */   {0,  L,  L,    L,  L,  L,  L,  E1},
-/* | */   {G,  G,  L,    L,  L,  L,  L,  G},
-/* CAT*/  {G,  G,  G,    L,  L,  L,  L,  G},
-/* * */   {G,  G,  G,    G,  G,  G,  E7, G},
-/* + */   {G,  G,  G,    G,  G,  G,  E7, G},
-/* ? */   {G,  G,  G,    G,  G,  G,  E7, G},
-/* ( */   {E2, L,  L,    L,  L,  L,  L,  EQ},
-/* ) */   {G , G,  G,    G,  G,  G,  E7, G}     }   ;
+static  short  table[9][9]  =  {
+/*        0   |   CAT   *   +   ?   (   )   {} */
+/* 0 */   {0,  L,  L,    L,  L,  L,  L,  E1, L},
+/* | */   {G,  G,  L,    L,  L,  L,  L,  G,  L},
+/* CAT*/  {G,  G,  G,    L,  L,  L,  L,  G,  L},
+/* * */   {G,  G,  G,    G,  G,  G,  E7, G,  G},
+/* + */   {G,  G,  G,    G,  G,  G,  E7, G,  G},
+/* ? */   {G,  G,  G,    G,  G,  G,  E7, G,  G},
+/* ( */   {E2, L,  L,    L,  L,  L,  L,  EQ, L},
+/* ) */   {G , G,  G,    G,  G,  G,  E7, G,  G},
+/* {} */  {G,  G,  G,    G,  G,  G,  E7, G,  G}     }   ;
 /* *INDENT-ON* */
 
 #define	 STACKSZ   64
 
 static jmp_buf err_buf;		/*  used to trap on error */
+static int groups = -1;		/* counted for RE_compile_groups() */
+
+/*
+ * Alongside each machine on the stack, REcompile() keeps the literals
+ * which every match of it begins with, ends with and contains.  The
+ * longest string contained is given to RE_set_must().
+ */
+#define	 MUST_MAX  64
+
+typedef struct {
+    int exact;			/* the machine matches only "prefix" */
+    size_t pre_len;
+    size_t suf_len;
+    size_t must_len;
+    char prefix[MUST_MAX];
+    char suffix[MUST_MAX];
+    char must[MUST_MAX];
+} LITERALS;
+
+static LITERALS lit_stack[STACKSZ];
+
+/* a machine which tells nothing */
+static void
+lit_none(LITERALS * lp)
+{
+    lp->exact = 0;
+    lp->pre_len = lp->suf_len = lp->must_len = 0;
+}
+
+/*
+ * If each member of the class is some case of one letter, return that
+ * letter in lower case, else zero.
+ */
+static int
+lit_letter(BV * bvp)
+{
+    int c;
+    int lower = 0;
+
+    for (c = 1; c < 256; ++c) {
+	if (ison(*bvp, c)) {
+	    if (lower == 0)
+		lower = tolower(c);
+	    else if (tolower(c) != lower)
+		return 0;
+	}
+    }
+    return ison(*bvp, 0) ? 0 : lower;
+}
+
+/*
+ * A machine made by RE_lex().  If fold is set, the literals are kept in
+ * lower case, since RE_lex() makes a class of each letter.
+ */
+static void
+lit_token(LITERALS * lp, int token, MACHINE * mp, int fold)
+{
+    STATE *p = mp->start;
+    size_t len;
+    int c;
+
+    lit_none(lp);
+    switch (token) {
+    case T_STR:
+	len = (size_t) p->s_len;
+	/* REtest() compares strings containing nulls with strncmp() */
+	if (len <= MUST_MAX && !memchr(p->s_data.str, 0, len)) {
+	    lp->exact = 1;
+	    memcpy(lp->prefix, p->s_data.str, len);
+	    memcpy(lp->suffix, p->s_data.str, len);
+	    memcpy(lp->must, p->s_data.str, len);
+	    lp->pre_len = lp->suf_len = lp->must_len = len;
+	}
+	break;
+    case T_CLASS:
+	if (fold && (c = lit_letter(p->s_data.bvp)) != 0) {
+	    lp->exact = 1;
+	    lp->prefix[0] = lp->suffix[0] = lp->must[0] = (char) c;
+	    lp->pre_len = lp->suf_len = lp->must_len = 1;
+	}
+	break;
+    case T_START:
+    case T_END:
+	/* these match only an empty string */
+	lp->exact = 1;
+	break;
+    }
+}
+
+/* keep the longer of the string in lp->must and s */
+static void
+lit_longer(LITERALS * lp, const char *s, size_t len)
+{
+    if (len > lp->must_len) {
+	memmove(lp->must, s, len);
+	lp->must_len = len;
+    }
+}
+
+/* replace m and n by mn */
+static void
+lit_cat(LITERALS * mp, LITERALS * np)
+{
+    char join[2 * MUST_MAX];
+    size_t len;
+
+    /* the end of m is followed by the start of n */
+    memcpy(join, mp->suffix, mp->suf_len);
+    memcpy(join + mp->suf_len, np->prefix, np->pre_len);
+    len = mp->suf_len + np->pre_len;
+
+    if (mp->exact) {
+	size_t keep = (len < MUST_MAX) ? len : MUST_MAX;
+
+	memcpy(mp->prefix, join, keep);
+	mp->pre_len = keep;
+	mp->exact = np->exact && (len <= MUST_MAX);
+    } else {
+	mp->exact = 0;
+    }
+    if (np->exact) {
+	size_t keep = (len < MUST_MAX) ? len : MUST_MAX;
+
+	memcpy(mp->suffix, join + len - keep, keep);
+	mp->suf_len = keep;
+    } else {
+	memcpy(mp->suffix, np->suffix, np->suf_len);
+	mp->suf_len = np->suf_len;
+    }
+
+    lit_longer(mp, np->must, np->must_len);
+    lit_longer(mp, join, (len < MUST_MAX) ? len : MUST_MAX);
+    lit_longer(mp, mp->prefix, mp->pre_len);
+    lit_longer(mp, mp->suffix, mp->suf_len);
+}
+
+/* replace m and n by m|n */
+static void
+lit_or(LITERALS * mp, LITERALS * np)
+{
+    size_t n;
+
+    if (mp->must_len != np->must_len
+	|| memcmp(mp->must, np->must, mp->must_len))
+	mp->must_len = 0;
+
+    for (n = 0; n < mp->pre_len && n < np->pre_len; ++n) {
+	if (mp->prefix[n] != np->prefix[n])
+	    break;
+    }
+    mp->exact = (mp->exact && np->exact
+		 && n == mp->pre_len && n == np->pre_len);
+    mp->pre_len = n;
+
+    for (n = 0; n < mp->suf_len && n < np->suf_len; ++n) {
+	if (mp->suffix[mp->suf_len - n - 1] != np->suffix[np->suf_len - n - 1])
+	    break;
+    }
+    memmove(mp->suffix, mp->suffix + mp->suf_len - n, n);
+    mp->suf_len = n;
+
+    lit_longer(mp, mp->prefix, mp->pre_len);
+    lit_longer(mp, mp->suffix, mp->suf_len);
+}
+
+/* replace m by m{lo,hi} */
+static void
+lit_repeat(LITERALS * lp, int lo, int hi)
+{
+    LITERALS one;
+    int n;
+
+    if (lo == 0) {
+	lit_none(lp);
+	lp->exact = (hi == 0);
+	return;
+    }
+    one = *lp;
+    for (n = 1; n < lo; ++n)
+	lit_cat(lp, &one);
+    if (hi != lo)
+	lp->exact = 0;
+}
 
 void
 RE_error_trap(int x)
@@ -94,14 +280,24 @@ REcompile(char *re, size_t len)
     struct op {
 	int token;
 	int prec;
+	int lo, hi;		/* the counts of T_REP, or for T_LP its
+				   group and the depth of m_stack */
     } op_stack[STACKSZ];
     register MACHINE *m_ptr;
     register struct op *op_ptr;
     register int t;
+    int fold = RE_fold;
+
+    /* (?i) at the start ignores case in this one */
+    if (len >= 4 && !memcmp(re, "(?i)", (size_t) 4)) {
+	re += 4;
+	len -= 4;
+	fold = 1;
+    }
 
     /* do this first because it also checks if we have a
        run time stack */
-    RE_lex_init(re, len);
+    RE_lex_init(re, len, fold);
 
     if (len == 0) {
 	STATE *p = (STATE *) RE_malloc(sizeof(STATE));
@@ -109,8 +305,10 @@ REcompile(char *re, size_t len)
 	return (PTR) p;
     }
 
-    if (setjmp(err_buf))
+    if (setjmp(err_buf)) {
+	RE_class_hold((STATE *) 0);
 	return (PTR) 0;
+    }
     /* we used to try to recover memory left on machine stack ;
        but now m_ptr is in a register so it won't be right unless
        we force it out of a register which isn't worth the trouble */
@@ -131,14 +329,25 @@ REcompile(char *re, size_t len)
 	case T_END:
 	case T_CLASS:
 	    m_ptr++;
+	    lit_token(lit_stack + (m_ptr - m_stack), t, m_ptr, fold);
 	    break;
 
 	case 0:		/*  end of reg expr   */
 	    if (op_ptr->token == 0) {
 		/*  done   */
-		if (m_ptr == m_stack)
+		if (m_ptr == m_stack) {
+		    RE_trie_done(m_ptr);
+		    /* str_str() is used for a single string anyway */
+		    if (groups < 0
+			&& !(m_ptr->start->s_type == M_STR
+			     && m_ptr->start[1].s_type == M_ACCEPT))
+			RE_set_must(m_ptr->start,
+				    lit_stack[0].must,
+				    lit_stack[0].must_len,
+				    fold);
+		    RE_class_hold(m_ptr->start);
 		    return (PTR) m_ptr->start;
-		else {
+		} else {
 		    /* machines still on the stack  */
 		    RE_panic("values still on machine stack");
 		}
@@ -161,27 +370,54 @@ REcompile(char *re, size_t len)
 
 		    switch (op_ptr->token) {
 		    case T_CAT:
+			RE_trie_done(m_ptr);
+			RE_trie_done(m_ptr + 1);
 			RE_cat(m_ptr, m_ptr + 1);
+			lit_cat(lit_stack + (m_ptr - m_stack),
+				lit_stack + (m_ptr - m_stack) + 1);
 			break;
 
 		    case T_OR:
-			RE_or(m_ptr, m_ptr + 1);
+			/* REgroups() wants the order of the alternatives */
+			if (groups >= 0 || !RE_trie_or(m_ptr, m_ptr + 1, fold))
+			    RE_or(m_ptr, m_ptr + 1);
+			lit_or(lit_stack + (m_ptr - m_stack),
+			       lit_stack + (m_ptr - m_stack) + 1);
 			break;
 
 		    case T_STAR:
+			RE_trie_done(m_ptr);
 			RE_close(m_ptr);
+			lit_none(lit_stack + (m_ptr - m_stack));
 			break;
 
 		    case T_PLUS:
+			RE_trie_done(m_ptr);
 			RE_poscl(m_ptr);
+			lit_stack[m_ptr - m_stack].exact = 0;
 			break;
 
 		    case T_Q:
+			RE_trie_done(m_ptr);
 			RE_01(m_ptr);
+			lit_none(lit_stack + (m_ptr - m_stack));
+			break;
+
+		    case T_REP:
+			RE_trie_done(m_ptr);
+			RE_repeat(m_ptr, op_ptr->lo, op_ptr->hi);
+			lit_repeat(lit_stack + (m_ptr - m_stack),
+				   op_ptr->lo, op_ptr->hi);
+			break;
+
+		    case T_RP:
+			/* ( and ) leave the group on the stack */
+			if (groups >= 0 && m_ptr - m_stack > op_ptr[-1].hi)
+			    RE_group(m_ptr, op_ptr[-1].lo);
 			break;
 
 		    default:
-			/*nothing on ( or ) */
+			/*nothing on ( */
 			break;
 		    }
 
@@ -205,6 +441,14 @@ REcompile(char *re, size_t len)
 	    }
 
 	    op_ptr->token = t;
+	    if (t == T_LP) {
+		/* number the group, and note the depth of the stack */
+		op_ptr->lo = (groups >= 0) ? ++groups : 0;
+		op_ptr->hi = (int) (m_ptr - m_stack);
+	    } else {
+		op_ptr->lo = RE_rep_lo;
+		op_ptr->hi = RE_rep_hi;
+	    }
 	}			/* end of switch */
 
 	if (m_ptr == m_stack + (STACKSZ - 1)) {
@@ -216,34 +460,73 @@ REcompile(char *re, size_t len)
     }
 }
 
+/*
+ * Compile re as REcompile() does, but put M_OPEN and M_CLOSE around each
+ * group in parentheses, numbering them from 1 in the order of their (.
+ * Set *countp to the number of groups.
+ */
+STATE *
+RE_compile_groups(char *re, size_t len, int *countp)
+{
+    STATE *m;
+
+    groups = 0;
+    m = (STATE *) REcompile(re, len);
+    *countp = groups;
+    groups = -1;
+    return m;
+}
+
 void
 REdestroy(PTR ptr)
 {
-    int done = 0;
-    int n = 0;
     STATE *q = (STATE *) ptr;
 
     TRACE(("REdestroy %p\n", q));
-    while (!done) {
-	TRACE(("...%d type %d\n", n, q->s_type));
-	switch (q->s_type) {
-	case M_ACCEPT:
-	    done = 1;
-	    break;
+    RE_dfa_forget(q);
+    /* the U_ON and END_ON variants own the same data */
+    while (q->s_type != M_ACCEPT) {
+	switch (q->s_type % U_ON) {
 	case M_STR:
 	    RE_free(q->s_data.str);
 	    break;
-	default:
-	    if (q->s_type < 0 || q->s_type > END_ON)
-		done = -1;
+	case M_CLASS:
+	    RE_class_release(q->s_data.bvp);
+	    break;
+	case M_TRIE:
+	    RE_trie_free(q->s_data.trie);
 	    break;
 	}
 	++q;
-	++n;
     }
     RE_free(ptr);
 }
 
+/* the memory used by a machine, its classes, and the DFA made so far */
+size_t
+REsize(PTR ptr)
+{
+    STATE *q = (STATE *) ptr;
+    size_t result = sizeof(STATE) + RE_dfa_size(q);
+
+    while (q->s_type != M_ACCEPT) {
+	switch (q->s_type % U_ON) {
+	case M_STR:
+	    result += (size_t) q->s_len + 1;
+	    break;
+	case M_CLASS:
+	    result += sizeof(SCAN_BV);
+	    break;
+	case M_TRIE:
+	    result += RE_trie_size(q->s_data.trie);
+	    break;
+	}
+	result += sizeof(STATE);
+	++q;
+    }
+    return result;
+}
+
 /* getting here means a logic flaw or unforeseen case */
 void
 RE_panic(const char *s)
@@ -80,16 +80,36 @@ extern void RE_free(void *);
 #define  M_SAVE_POS	9	/* push position onto stack */
 #define  M_2JC     	10	/* pop pos'n, optional jump if advanced */
 #define  M_ACCEPT  	11	/* end of match */
-#define  U_ON      	12
+#define  M_OPEN    	12	/* start of a group, only for REgroups() */
+#define  M_CLOSE   	13	/* end of a group */
+#define  M_TRIE    	14	/* any of a list of literal strings */
+#define  U_ON      	15
 
 #define  U_OFF     0
 #define  END_OFF   0
 #define  END_ON    (2*U_ON)
 
 typedef UChar BV[32];		/* bit vector */
+
+/*
+ * The BV of an M_CLASS is allocated as a SCAN_BV, whose tables let
+ * RE_class_scan() test 16 or 32 characters at a time.  Bit h of low[n] is
+ * set if character 16 * h + n is in the class, of high[n] if 16 * (h + 8) + n
+ * is.  The classes of machines are shared, see store_bvp().
+ */
+typedef struct scan_bv {
+    BV bv;
+    UChar low[16];
+    UChar high[16];
+    struct scan_bv *link;	/* next with the same hash */
+    unsigned refs;		/* STATEs of compiled machines using it */
+} SCAN_BV;
+
 typedef char SType;
 typedef UChar SLen;
 
+typedef struct re_trie TRIE;
+
 typedef struct {
     SType s_type;
     SLen s_len;			/* used for M_STR  */
@@ -97,6 +117,7 @@ typedef struct {
 	char *str;		/* string */
 	BV *bvp;		/*  class  */
 	int jump;
+	TRIE *trie;		/* M_TRIE */
     } s_data;
 } STATE;
 
@@ -106,6 +127,31 @@ typedef struct {
     STATE *start, *stop;
 } MACHINE;
 
+/*
+ * An alternation of many literals is compiled to one M_TRIE, see rexp9.c.
+ * Node 0 is the root.  Its children are indexed by byte, the others are
+ * hashed by their parent and byte.
+ */
+#define  TRIE_FINAL	1	/* a word ends at the node */
+#define  TRIE_KIDS	2	/* a longer word goes on from it */
+
+struct re_trie {
+    int links;			/* STATEs which share it */
+    int words;
+    int nodes;
+    int depth;			/* length of the longest word */
+    int root[256];
+    unsigned *keys;		/* parent * 256 + byte, or 0 if empty */
+    int *kids;
+    unsigned mask;		/* size of keys[] less one */
+    unsigned used;
+    UChar *flags;		/* per node */
+    int flags_size;
+    UChar map[256];		/* each byte, or its lower case */
+    SCAN_BV first;		/* the bytes which can begin a word */
+    MACHINE *saved;		/* the first few words, see RE_trie_done() */
+};
+
 /*  tokens   */
 #define  T_NONE   0		/* no token */
 #define  T_OR     1		/* | */
@@ -115,14 +161,17 @@ typedef struct {
 #define  T_Q      5		/* ? */
 #define  T_LP     6		/* ( */
 #define  T_RP     7		/* ) */
-#define  T_START  8		/* ^ */
-#define  T_END    9		/* $ */
-#define  T_ANY   10		/* . */
-#define  T_CLASS 11		/* starts with [ */
-#define  T_SLASH 12		/*  \  */
-#define  T_CHAR  13		/* all the rest */
-#define  T_STR   14		/* string built of other tokens */
-#define  T_U     15
+#define  T_REP    8		/* {n,m} */
+#define  T_START  9		/* ^ */
+#define  T_END   10		/* $ */
+#define  T_ANY   11		/* . */
+#define  T_CLASS 12		/* starts with [ */
+#define  T_SLASH 13		/*  \  */
+#define  T_CHAR  14		/* all the rest */
+#define  T_STR   15		/* string built of other tokens */
+#define  T_U     16
+
+#define  REP_MAX 255		/* largest count in {n,m} */
 
 /*  precedences and error codes  */
 #define  L   0
@@ -182,14 +231,75 @@ extern void RE_or(MACHINE *, MACHINE *);
 extern void RE_close(MACHINE *);
 extern void RE_poscl(MACHINE *);
 extern void RE_01(MACHINE *);
+extern void RE_repeat(MACHINE *, int, int);
+extern void RE_group(MACHINE *, int);
 extern void RE_panic(const char *) GCC_NORETURN;
 
 #ifndef MAWK_H
 extern char *str_str(char *, size_t, char *, size_t);
 #endif
 
-extern void RE_lex_init(char *, size_t);
+extern void RE_class_init(SCAN_BV *);
+extern char *RE_class_scan(SCAN_BV *, char *, char *);
+extern void RE_class_hold(STATE *);
+extern void RE_class_release(BV *);
+
+/*
+ * The DFA can be translated to native code, see rexp6.c.
+ */
+#if defined(__x86_64__) && defined(__GNUC__) && defined(HAVE_MMAP) && !defined(_WIN32) \
+	&& !defined(NO_REGEX_JIT)
+#define USE_JIT 1
+#else
+#define USE_JIT 0
+#endif
+
+#define JIT_MISS	(-1)	/* no transition made yet */
+#define JIT_ACCEPT	(-2)
+#define JIT_DEAD	(-3)
+
+typedef struct jit JIT;
+typedef const UChar *(*JIT_SKIP_FN) (const UChar *, const UChar *, void *);
+
+extern JIT *RE_jit(int, const int *, void **, JIT_SKIP_FN);
+extern int RE_jit_run(JIT *, const UChar *, const UChar *, int, const UChar **);
+extern void RE_jit_free(JIT *);
+
+extern int RE_pike_test(char *, size_t, STATE *);
+extern char *RE_pike_match(char *, size_t, STATE *, size_t *, char *, char **);
+extern long RE_backtrack_limit(size_t);
+#ifdef NO_LEAKS
+extern void RE_pike_leaks(void);
+#endif
+
+extern int RE_dfa_test(char *, size_t, STATE *);
+extern void RE_dfa_forget(STATE *);
+extern size_t RE_dfa_size(STATE *);
+extern void RE_set_must(STATE *, char *, size_t, int);
+extern int RE_lacks_must(STATE *, char *, size_t);
+#ifdef NO_LEAKS
+extern void RE_dfa_leaks(void);
+#endif
+
+extern int RE_trie_or(MACHINE *, MACHINE *, int);
+extern void RE_trie_done(MACHINE *);
+extern void RE_trie_free(TRIE *);
+extern size_t RE_trie_size(TRIE *);
+extern int RE_trie_next(TRIE *, int, int);
+extern int RE_trie_walk(TRIE *, char *, char *, char ***, int *);
+#ifdef NO_LEAKS
+extern void RE_trie_leaks(void);
+#endif
+
+extern STATE *RE_compile_groups(char *, size_t, int *);
+#ifdef NO_LEAKS
+extern void RE_groups_leaks(void);
+#endif
+
+extern void RE_lex_init(char *, size_t, int);
 extern int RE_lex(MACHINE *);
+extern int RE_rep_lo;
+extern int RE_rep_hi;
 extern void RE_run_stack_init(void);
 extern void RE_pos_stack_init(void);
 extern RT_STATE *RE_new_run_stack(void);
@@ -78,6 +78,8 @@ typedef struct {
 /* static functions */
 static int do_str(int, char **, MACHINE *);
 static int do_class(char **, MACHINE *);
+static int do_letter(int, MACHINE *);
+static int interval(char *, int *, int *);
 static int escape(char **);
 static BV *store_bvp(BV *);
 
@@ -115,12 +117,30 @@ static size_t nest;
 static char *lp;		/*  ptr to reg exp string  */
 static char *re_str;		/*  base of 'lp' */
 static size_t re_len;
+static int fold;		/* ignore case */
+static char *str_buff;		/* do_str() collects a string here */
+static size_t str_size;
+
+int RE_fold;			/* -W ignorecase */
+
+/* the counts of the last T_REP, hi is -1 if there is no limit */
+int RE_rep_lo;
+int RE_rep_hi;
+
+/* can c match a character which differs from it? */
+#define has_case(c) \
+	(tolower((UChar) (c)) != (UChar) (c) || toupper((UChar) (c)) != (UChar) (c))
 
 void
-RE_lex_init(char *re, size_t len)
+RE_lex_init(char *re, size_t len, int fold_case)
 {
     re_str = lp = re;
     re_len = len + 1;
+    if (re_len > str_size) {
+	str_buff = (char *) RE_realloc(str_buff, re_len);
+	str_size = re_len;
+    }
+    fold = fold_case;
     prev = NOT_STARTED;
     nest = 0;
     RE_run_stack_init();
@@ -134,8 +154,8 @@ RE_lex_init(char *re, size_t len)
  * before returning the appropriate token, this will write the
  * corresponding machine to *mp.
  *
- * For the rest (T_PLUS, T_STAR, T_OR, T_Q, T_RP, T_LP, and T_CAT), *mp
- * is left alone.
+ * For the rest (T_PLUS, T_STAR, T_OR, T_Q, T_REP, T_RP, T_LP, and T_CAT),
+ * *mp is left alone.  For T_REP, the counts are in RE_rep_lo and RE_rep_hi.
  *
  * Returns 0 for end of regexp.
  */
@@ -153,6 +173,27 @@ RE_lex(MACHINE * mp)
 	return 0;
     }
 
+    /* {n,m} repeats what precedes it, else { is ordinary */
+    if (*lp == '{') {
+	switch (prev) {
+	case T_CHAR:
+	case T_STR:
+	case T_ANY:
+	case T_CLASS:
+	case T_RP:
+	case T_PLUS:
+	case T_STAR:
+	case T_Q:
+	case T_REP:
+	case T_U:
+	    if ((c = interval(lp, &RE_rep_lo, &RE_rep_hi)) != 0) {
+		lp += c;
+		return prev = T_REP;
+	    }
+	    break;
+	}
+    }
+
     switch (c = char2token((UChar) (*lp))) {
     case T_PLUS:
     case T_STAR:
@@ -189,6 +230,7 @@ RE_lex(MACHINE * mp)
 	case T_PLUS:
 	case T_STAR:
 	case T_Q:
+	case T_REP:
 	case T_U:
 	    return prev = T_CAT;
 
@@ -279,10 +321,48 @@ RE_lex(MACHINE * mp)
     return prev;
 }
 
+/*
+ * If p starts an interval, {n}, {n,}, {n,m} or {,m}, set its counts and
+ * return its length, else return 0.
+ */
+static int
+interval(char *p, int *lo, int *hi)
+{
+    char *q = p + 1;
+
+    if (!isdigit((UChar) * q) && !(*q == ',' && isdigit((UChar) q[1])))
+	return 0;
+    for (*lo = 0; isdigit((UChar) * q); ++q) {
+	if ((*lo = *lo * 10 + (*q - '0')) > REP_MAX)
+	    RE_error_trap(7);
+    }
+    if (*q == '}') {
+	*hi = *lo;
+    } else if (*q++ != ',') {
+	return 0;
+    } else if (*q == '}') {
+	*hi = -1;
+    } else if (!isdigit((UChar) * q)) {
+	return 0;
+    } else {
+	for (*hi = 0; isdigit((UChar) * q); ++q) {
+	    if ((*hi = *hi * 10 + (*q - '0')) > REP_MAX)
+		RE_error_trap(7);
+	}
+	if (*q != '}')
+	    return 0;
+	if (*hi < *lo)
+	    RE_error_trap(7);
+    }
+    return (int) (q + 1 - p);
+}
+
 /*
   Collect a run of characters into a string machine.
-  If the run ends at *,+, or ?, then don't take the last
+  If the run ends at *,+,? or {n,m}, then don't take the last
   character unless the string has length one.
+  When ignoring case, a letter is a class of its two cases,
+  and ends the run.
 */
 
 static int
@@ -293,12 +373,16 @@ do_str(
 {
     register char *p;		/* runs thru the input */
     char *pt = 0;		/* trails p by one */
-    char *str;			/* collect it here */
+    char *str;			/* a copy of what was collected */
     register char *s;		/* runs thru the output */
     size_t len;			/* length collected */
+    int lo, hi;
+
+    if (fold && has_case(c))
+	return do_letter(c, mp);
 
     p = *pp;
-    s = str = RE_malloc(re_len);
+    s = str_buff;
     *s++ = (char) c;
     len = 1;
 
@@ -307,14 +391,21 @@ do_str(
 
 	switch (char2token((UChar) (*p))) {
 	case T_CHAR:
+	    if (fold && has_case(*p))
+		goto out;
+	    if (*p == '{' && interval(p, &lo, &hi))
+		goto out;
 	    pt = p;
 	    *s++ = *p++;
 	    break;
 
 	case T_SLASH:
-	    pt = p;
 	    save = p + 1;	/* keep p in a register */
-	    *s++ = (char) escape(&save);
+	    c = escape(&save);
+	    if (fold && has_case(c))
+		goto out;
+	    pt = p;
+	    *s++ = (char) c;
 	    p = save;
 	    break;
 
@@ -325,8 +416,8 @@ do_str(
     }
 
   out:
-    /* if len > 1 and we stopped on a ? + or * , need to back up */
-    if (len > 1 && (*p == '*' || *p == '+' || *p == '?')) {
+    /* if len > 1 and we stopped on a ? + * or { , need to back up */
+    if (len > 1 && (*p == '*' || *p == '+' || *p == '?' || *p == '{')) {
 	len--;
 	p = pt;
 	s--;
@@ -334,7 +425,10 @@ do_str(
 
     *s = 0;
     *pp = p;
-    *mp = RE_str((char *) RE_realloc(str, len + 1), len);
+    /* allocating only the string keeps a list of words linear */
+    str = (char *) RE_malloc(len + 1);
+    memcpy(str, str_buff, len + 1);
+    *mp = RE_str(str, len);
     return T_STR;
 }
 
@@ -364,6 +458,20 @@ block_on(BV b, int x, int y)
     }
 }
 
+/* add the other case of each letter in b */
+static void
+fold_bv(BV b)
+{
+    int c;
+
+    for (c = 0; c < 256; ++c) {
+	if (ison(b, c)) {
+	    char_on(b, tolower(c));
+	    char_on(b, toupper(c));
+	}
+    }
+}
+
 #define CCLASS_DATA(name) { CCLASS_##name, #name, sizeof(#name) - 1, 0 }
 
 typedef enum {
@@ -614,8 +722,8 @@ do_class(char **start, MACHINE * mp)
     p = *start + 1;
     *start = q + 1;
 
-    bvp = (BV *) RE_malloc(sizeof(BV));
-    memset(bvp, 0, sizeof(BV));
+    bvp = (BV *) RE_malloc(sizeof(SCAN_BV));
+    memset(bvp, 0, sizeof(SCAN_BV));
 
     if (*p == '^') {
 	comp_flag = 1;
@@ -681,6 +789,9 @@ do_class(char **start, MACHINE * mp)
 	}
     }
 
+    if (fold)
+	fold_bv(*bvp);
+
     if (comp_flag) {
 	for (p = (char *) bvp; p < (char *) bvp + sizeof(BV); p++) {
 	    *p = (char) (~*p);
@@ -691,53 +802,115 @@ do_class(char **start, MACHINE * mp)
     return T_CLASS;
 }
 
-/* storage for bit vectors so they can be reused ,
-   stored in an unsorted linear array
-   the array grows as needed
+/* a class of both cases of the letter c */
+static int
+do_letter(int c, MACHINE * mp)
+{
+    BV *bvp = (BV *) RE_malloc(sizeof(SCAN_BV));
+
+    memset(bvp, 0, sizeof(SCAN_BV));
+    char_on(*bvp, (UChar) c);
+    fold_bv(*bvp);
+    *mp = RE_class(store_bvp(bvp));
+    return T_CLASS;
+}
+
+/* storage for bit vectors so they can be shared, hashed on their
+   contents.  Each STATE of a compiled machine holds a reference to its
+   class, taken by RE_class_hold() at the end of REcompile() and given
+   back by REdestroy().  A class which the compile made but did not use
+   in the end is freed then.
 */
 
-#define		BV_GROWTH	6
+#define		BV_BUCKETS	1024
 
-static BV **bv_base, **bv_limit;
-static BV **bv_next;		/* next empty slot in the array */
+static SCAN_BV *bv_table[BV_BUCKETS];
+static SCAN_BV **bv_fresh;	/* made by the current compile */
+static unsigned bv_fresh_count;
+static unsigned bv_fresh_max;
+
+static unsigned
+bv_hash(BV * bvp)
+{
+    UChar *p = (UChar *) bvp;
+    unsigned h = 0;
+    size_t n;
+
+    for (n = 0; n < sizeof(BV); ++n)
+	h = h * 31 + p[n];
+    return h % BV_BUCKETS;
+}
 
 static BV *
 store_bvp(BV * bvp)
 {
-    register BV **p;
-    unsigned t;
-
-    if (bv_next == bv_limit) {
-	/* need to grow */
-	if (!bv_base) {
-	    /* first growth */
-	    t = 0;
-	    bv_base = (BV **) RE_malloc(BV_GROWTH * sizeof(BV *));
-	} else {
-	    t = (unsigned) (bv_next - bv_base);
-	    bv_base = (BV **) RE_realloc(bv_base,
-					 (t + BV_GROWTH) * sizeof(BV *));
+    SCAN_BV **pp = &bv_table[bv_hash(bvp)];
+    SCAN_BV *p;
+
+    for (p = *pp; p != 0; p = p->link) {
+	if (!memcmp(p->bv, bvp, sizeof(BV))) {
+	    /* we already have it */
+	    RE_free(bvp);
+	    return (BV *) p;
 	}
+    }
 
-	bv_next = bv_base + t;
-	bv_limit = bv_next + BV_GROWTH;
+    /* it is new */
+    p = (SCAN_BV *) bvp;
+    RE_class_init(p);
+    p->refs = 0;
+    p->link = *pp;
+    *pp = p;
+
+    if (bv_fresh_count == bv_fresh_max) {
+	bv_fresh_max = bv_fresh_max ? 2 * bv_fresh_max : 16;
+	bv_fresh = (SCAN_BV **) (bv_fresh
+				 ? RE_realloc(bv_fresh,
+					      bv_fresh_max * sizeof(SCAN_BV *))
+				 : RE_malloc(bv_fresh_max * sizeof(SCAN_BV *)));
     }
+    bv_fresh[bv_fresh_count++] = p;
+    return bvp;
+}
 
-    /* put bvp in bv_next as a sentinal */
-    *bv_next = bvp;
-    p = bv_base;
-    while (memcmp(*p, bvp, sizeof(BV)))
-	p++;
+static void
+free_bvp(SCAN_BV * p)
+{
+    SCAN_BV **pp = &bv_table[bv_hash(&p->bv)];
 
-    if (p == bv_next) {
-	/* it is new */
-	bv_next++;
-    } else {
-	/* we already have it */
-	RE_free(bvp);
+    while (*pp != p)
+	pp = &(*pp)->link;
+    *pp = p->link;
+    RE_free(p);
+}
+
+/* the compile which made machine m (null if it failed) is done */
+void
+RE_class_hold(STATE * m)
+{
+    unsigned n;
+
+    if (m != 0) {
+	for (; m->s_type != M_ACCEPT; ++m) {
+	    if ((m->s_type % U_ON) == M_CLASS)
+		((SCAN_BV *) m->s_data.bvp)->refs++;
+	}
+    }
+    for (n = 0; n < bv_fresh_count; ++n) {
+	if (bv_fresh[n]->refs == 0)
+	    free_bvp(bv_fresh[n]);
     }
+    bv_fresh_count = 0;
+}
+
+/* a STATE using bvp is being destroyed */
+void
+RE_class_release(BV * bvp)
+{
+    SCAN_BV *p = (SCAN_BV *) bvp;
 
-    return *p;
+    if (--(p->refs) == 0)
+	free_bvp(p);
 }
 
 /* ----------	convert escape sequences  -------------*/
@@ -231,6 +231,131 @@ RE_01(MACHINE * mp)
     p->s_data.jump = (int) sz;
 }
 
+/*  replace m by m between M_OPEN n and M_CLOSE n  */
+
+void
+RE_group(MACHINE * mp, int n)
+{
+    register STATE *p;
+    unsigned sz;
+
+    sz = (unsigned) (mp->stop - mp->start + 1);
+    p = (STATE *) RE_malloc((sz + 2) * STATESZ);
+    memcpy(p + 1, mp->start, sz * STATESZ);
+    RE_free(mp->start);
+    mp->start = p;
+    mp->stop = p + (sz + 1);
+    p->s_type = M_OPEN;
+    p->s_data.jump = n;
+    p += sz;
+    p->s_type = M_CLOSE;
+    p->s_data.jump = n;
+    (p + 1)->s_type = M_ACCEPT;
+}
+
+/* the most STATEs RE_repeat() will make */
+#define  REP_STATES  0x100000
+
+/*  a copy of m, with its own strings, sharing its tries  */
+static MACHINE
+RE_copy(MACHINE * mp)
+{
+    MACHINE x;
+    register STATE *p;
+    unsigned sz;
+
+    sz = (unsigned) (mp->stop - mp->start + 1);
+    x.start = (STATE *) RE_malloc(sz * STATESZ);
+    x.stop = x.start + (sz - 1);
+    memcpy(x.start, mp->start, sz * STATESZ);
+    for (p = x.start; p < x.stop; p++) {
+	if ((p->s_type % U_ON) == M_STR) {
+	    char *str = (char *) RE_malloc((size_t) p->s_len + 1);
+
+	    memcpy(str, p->s_data.str, (size_t) p->s_len + 1);
+	    p->s_data.str = str;
+	} else if (p->s_type == M_TRIE) {
+	    p->s_data.trie->links++;
+	}
+    }
+    return x;
+}
+
+/*  free m, with its strings  */
+static void
+RE_free_machine(MACHINE * mp)
+{
+    register STATE *p;
+
+    for (p = mp->start; p < mp->stop; p++) {
+	if ((p->s_type % U_ON) == M_STR)
+	    RE_free(p->s_data.str);
+	else if (p->s_type == M_TRIE)
+	    RE_trie_free(p->s_data.trie);
+    }
+    RE_free(mp->start);
+}
+
+/*
+ * replace  m  by  m{lo,hi}, or m{lo,} if hi < 0
+ *
+ * This is lo copies of m, followed by m+ if there is no limit, or by the
+ * hi - lo optional copies nested as (m(m(m)?)?)?, which backtracks less
+ * than m?m?m? would.
+ */
+void
+RE_repeat(MACHINE * mp, int lo, int hi)
+{
+    MACHINE m;			/* the original, used by the last copy */
+    MACHINE rest;		/* what follows the lo copies */
+    MACHINE x;
+    int n;
+
+    m = *mp;
+    rest.start = rest.stop = 0;
+    if ((unsigned) (m.stop - m.start + 1) * (unsigned) (hi < 0 ? lo + 1 : hi)
+	> REP_STATES)
+	RE_error_trap(MEMORY_FAILURE);
+
+    if (hi < 0) {
+	if (lo == 0) {
+	    RE_close(mp);
+	    return;
+	}
+	rest = RE_copy(&m);
+	RE_poscl(&rest);
+	--lo;
+    } else if (hi > lo) {
+	rest = RE_copy(&m);
+	RE_01(&rest);
+	for (n = hi - lo; n > 1; --n) {
+	    x = RE_copy(&m);
+	    RE_cat(&x, &rest);
+	    RE_01(&x);
+	    rest = x;
+	}
+    } else if (hi == 0) {
+	/* only the empty string */
+	rest.start = rest.stop = (STATE *) RE_malloc(STATESZ);
+	rest.start->s_type = M_ACCEPT;
+    }
+
+    if (lo == 0) {
+	RE_free_machine(&m);
+	*mp = rest;
+	return;
+    }
+    *mp = (lo > 1) ? RE_copy(&m) : m;
+    for (n = 2; n < lo; n++) {
+	x = RE_copy(&m);
+	RE_cat(mp, &x);
+    }
+    if (lo > 1)
+	RE_cat(mp, &m);
+    if (rest.start != 0)
+	RE_cat(mp, &rest);
+}
+
 /*===================================
 MEMORY	ALLOCATION
  *==============================*/
@@ -64,6 +64,16 @@ the GNU General Public License, version 2, 1991.
 
 #include "rexp.h"
 
+/* x86 compilers which can build SSSE3 and AVX2 functions for a CPU chosen
+   when running */
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) \
+	&& (__GNUC__ >= 5 || defined(__clang__))
+#define USE_CLASS_SIMD 1
+#include <immintrin.h>
+#else
+#define USE_CLASS_SIMD 0
+#endif
+
 #define	 STACKGROWTH	16
 
 RT_STATE *RE_run_stack_base;
@@ -77,6 +87,8 @@ RT_POS_ENTRY *RE_pos_stack_base;
 RT_POS_ENTRY *RE_pos_stack_limit;
 RT_POS_ENTRY *RE_pos_stack_empty;
 
+unsigned long RE_pushes;	/* states saved to backtrack to */
+
 void
 RE_run_stack_init(void)
 {
@@ -184,12 +196,146 @@ slow_push(
 }
 #endif
 
+/* fill in the tables of a SCAN_BV from its BV */
+void
+RE_class_init(SCAN_BV * p)
+{
+    int c;
+
+    memset(p->low, 0, sizeof(p->low));
+    memset(p->high, 0, sizeof(p->high));
+    for (c = 0; c < 256; ++c) {
+	if (ison(p->bv, c)) {
+	    if (c < 128)
+		p->low[c & 15] |= (UChar) (1 << (c >> 4));
+	    else
+		p->high[c & 15] |= (UChar) (1 << ((c >> 4) - 8));
+	}
+    }
+}
+
+static char *
+class_scan_bv(SCAN_BV * p, char *s, char *str_end)
+{
+    while (s < str_end && !ison(p->bv, s[0]))
+	s++;
+    return s;
+}
+
+#if USE_CLASS_SIMD
+/*
+ * Each character's low nibble indexes the table for the half its high
+ * nibble is in, giving the high nibbles which are in the class with it.
+ * pshufb gives zero for an index with the top bit set, which selects the
+ * half.  The high nibble then indexes the bit to test.
+ */
+#define CLASS_BITS(v) \
+	v(1, 2, 4, 8, 16, 32, 64, (char) 128, \
+	  1, 2, 4, 8, 16, 32, 64, (char) 128)
+
+__attribute__((target("ssse3")))
+static char *
+class_scan_ssse3(SCAN_BV * p, char *s, char *str_end)
+{
+    const __m128i low = _mm_loadu_si128((const __m128i *) (void *) p->low);
+    const __m128i high = _mm_loadu_si128((const __m128i *) (void *) p->high);
+    const __m128i bits = CLASS_BITS(_mm_setr_epi8);
+    const __m128i m8f = _mm_set1_epi8((char) 0x8f);
+    const __m128i m80 = _mm_set1_epi8((char) 0x80);
+    const __m128i m0f = _mm_set1_epi8(0x0f);
+
+    while (str_end - s >= 16) {
+	__m128i x = _mm_loadu_si128((const __m128i *) (void *) s);
+	__m128i in_low = _mm_shuffle_epi8(low, _mm_and_si128(x, m8f));
+	__m128i in_high = _mm_shuffle_epi8(high,
+					   _mm_and_si128(_mm_xor_si128(x, m80), m8f));
+	__m128i bit = _mm_shuffle_epi8(bits,
+				       _mm_and_si128(_mm_srli_epi16(x, 4), m0f));
+	__m128i row = _mm_and_si128(_mm_or_si128(in_low, in_high), bit);
+	int hits = _mm_movemask_epi8(_mm_cmpeq_epi8(row, bit));
+
+	if (hits != 0)
+	    return s + __builtin_ctz((unsigned) hits);
+	s += 16;
+    }
+    return class_scan_bv(p, s, str_end);
+}
+
+__attribute__((target("avx2")))
+static char *
+class_scan_avx2(SCAN_BV * p, char *s, char *str_end)
+{
+    const __m128i low16 = _mm_loadu_si128((const __m128i *) (void *) p->low);
+    const __m128i high16 = _mm_loadu_si128((const __m128i *) (void *) p->high);
+    const __m256i low = _mm256_broadcastsi128_si256(low16);
+    const __m256i high = _mm256_broadcastsi128_si256(high16);
+    const __m256i bits = _mm256_broadcastsi128_si256(CLASS_BITS(_mm_setr_epi8));
+    const __m256i m8f = _mm256_set1_epi8((char) 0x8f);
+    const __m256i m80 = _mm256_set1_epi8((char) 0x80);
+    const __m256i m0f = _mm256_set1_epi8(0x0f);
+
+    while (str_end - s >= 32) {
+	__m256i x = _mm256_loadu_si256((const __m256i *) (void *) s);
+	__m256i in_low = _mm256_shuffle_epi8(low, _mm256_and_si256(x, m8f));
+	__m256i in_high = _mm256_shuffle_epi8(high,
+					      _mm256_and_si256(_mm256_xor_si256(x, m80),
+							       m8f));
+	__m256i bit = _mm256_shuffle_epi8(bits,
+					  _mm256_and_si256(_mm256_srli_epi16(x, 4),
+							   m0f));
+	__m256i row = _mm256_and_si256(_mm256_or_si256(in_low, in_high), bit);
+	unsigned hits = (unsigned) _mm256_movemask_epi8(_mm256_cmpeq_epi8(row,
+									  bit));
+
+	if (hits != 0)
+	    return s + __builtin_ctz(hits);
+	s += 32;
+    }
+    return class_scan_ssse3(p, s, str_end);
+}
+#endif /* USE_CLASS_SIMD */
+
+/*
+ * Return the first character from s which is in the class, or str_end.
+ * The first call picks the widest scan which the CPU supports.
+ */
+char *
+RE_class_scan(SCAN_BV * p, char *s, char *str_end)
+{
+    static char *(*scan) (SCAN_BV *, char *, char *);
+
+    if (s < str_end && ison(p->bv, s[0]))
+	return s;
+    if (scan == 0) {
+#if USE_CLASS_SIMD
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+	    scan = class_scan_avx2;
+	else if (__builtin_cpu_supports("ssse3"))
+	    scan = class_scan_ssse3;
+	else
+#endif
+	    scan = class_scan_bv;
+	TRACE(("RE_class_scan uses %s\n",
+	       ((scan == class_scan_bv)
+		? "BV"
+		: "SIMD")));
+    }
+    return scan(p, s, str_end);
+}
+
 #ifdef	 DEBUG
 #define	 push(mx,sx,px,ux) do { \
+		if (--budget < 0) \
+			goto linear; \
+		RE_pushes++; \
 		stackp = slow_push(++stackp, mx, sx, px, ux); \
 	} while(0)
 #else
 #define	 push(mx,sx,px,ux) do { \
+		if (--budget < 0) \
+			goto linear; \
+		RE_pushes++; \
 		if (++stackp == RE_run_stack_limit) \
 			stackp = RE_new_run_stack(); \
 		stackp->m = (mx); \
@@ -218,10 +364,20 @@ REtest(char *str,		/* string to test */
     RT_POS_ENTRY *sp;
     int t;			/*convenient temps */
     STATE *tm;
+    long budget;		/* states to push before giving up on this */
+    char **ends;		/* of the words an M_TRIE matches */
+    int cut;
+    int k;
 
     /* handle the easy case quickly */
-    if ((m + 1)->s_type == M_ACCEPT && m->s_type == M_STR) {
+    if (m->s_type == M_STR && (m + 1)->s_type == M_ACCEPT) {
 	return str_str(s, len, m->s_data.str, (size_t) m->s_len) != (char *) 0;
+    } else if (RE_lacks_must(m, s, len)) {
+	return 0;
+    } else if ((t = RE_dfa_test(str, len, m)) >= 0) {
+	return t;
+    } else if ((budget = RE_backtrack_limit(len)) == 0) {
+	goto linear;
     } else {
 	u_flag = U_ON;
 	stackp = RE_run_stack_empty;
@@ -290,13 +446,9 @@ REtest(char *str,		/* string to test */
 	goto reswitch;
 
     case M_CLASS + U_ON + END_OFF:
-	for (;;) {
-	    if (s >= str_end)
-		goto refill;
-	    else if (ison(*m->s_data.bvp, s[0]))
-		break;
-	    s++;
-	}
+	s = RE_class_scan((SCAN_BV *) m->s_data.bvp, s, str_end);
+	if (s >= str_end)
+	    goto refill;
 	s++;
 	push(m, s, sp, U_ON);
 	m++;
@@ -370,6 +522,38 @@ REtest(char *str,		/* string to test */
 	u_flag = U_OFF;
 	goto reswitch;
 
+    case M_TRIE + U_OFF:
+	/* go on after the longest word here, and push the others */
+	if ((t = RE_trie_walk(m->s_data.trie, s, str_end, &ends, &cut)) == 0)
+	    goto refill;
+	if ((m + 1)->s_type == M_ACCEPT)
+	    return 1;
+	for (k = 0; k < t - 1; ++k)
+	    push(m + 1, ends[k], sp, U_OFF);
+	s = ends[t - 1];
+	m++;
+	goto reswitch;
+
+    case M_TRIE + U_ON:
+	/* find the next place where a word begins */
+	for (;;) {
+	    s = RE_class_scan(&(m->s_data.trie->first), s, str_end);
+	    if (s >= str_end)
+		goto refill;
+	    if ((t = RE_trie_walk(m->s_data.trie, s, str_end, &ends, &cut)) != 0)
+		break;
+	    s++;
+	}
+	if ((m + 1)->s_type == M_ACCEPT)
+	    return 1;
+	push(m, s + 1, sp, U_ON);
+	for (k = 0; k < t - 1; ++k)
+	    push(m + 1, ends[k], sp, U_OFF);
+	s = ends[t - 1];
+	m++;
+	u_flag = U_OFF;
+	goto reswitch;
+
       CASE_UANY(M_U):
 	u_flag = U_ON;
 	m++;
@@ -414,6 +598,10 @@ REtest(char *str,		/* string to test */
     default:
 	RE_panic("unexpected case in REtest");
     }
+
+  linear:
+    /* backtracking has taken too long, or is not wanted */
+    return RE_pike_test(str, len, (STATE *) machine);
 }
 
 #undef push
@@ -52,6 +52,9 @@ the GNU General Public License, version 2, 1991.
 #include "rexp.h"
 
 #define	 push(mx,sx,px,ssx,ux) do { \
+	if (--budget < 0) \
+		goto linear; \
+	RE_pushes++; \
 	if (++stackp == RE_run_stack_limit) \
 		stackp = RE_new_run_stack() ;\
 	stackp->m = (mx); \
@@ -62,6 +65,17 @@ the GNU General Public License, version 2, 1991.
 	stackp->u = (ux); \
 } while(0)
 
+/* note the start of a match which was cut short by the end of the string */
+#define	 cut_short(x) do { \
+	if (partp != 0 && (x) < *partp) \
+		*partp = (x); \
+} while(0)
+
+/* the leftmost place where a literal of length n might begin, but run off
+   the end of the string */
+#define	 tail_of(sx,n) \
+	(((size_t) (str_end - (sx)) >= (n)) ? str_end - (n) + 1 : (sx))
+
 #define	  CASE_UANY(x)	case  x + U_OFF :  case	 x + U_ON
 
 /* returns start of first longest match and the length by
@@ -72,15 +86,45 @@ REmatch(char *str,		/* string to test */
 	size_t str_len,		/* ...its length */
 	PTR machine,		/* compiled regular expression */
 	size_t *lenp)		/* where to return matched-length */
+{
+    /* every match contains a string, perhaps */
+    if (RE_lacks_must((STATE *) machine, str, str_len)) {
+	*lenp = 0;
+	return (char *) 0;
+    }
+    return REmatch_resume(str, str_len, machine, lenp, str, (char **) 0);
+}
+
+/*
+ * Like REmatch, but matches may only start at or after "from" (str is still
+ * the start for ^).  If partp is given, it is set to the start of the
+ * leftmost match which reached the end of the string before it could
+ * succeed, or to str + str_len if there is none.  A caller which appends
+ * text to the string can resume searching from there: no match of the
+ * longer string can start before it.
+ */
+char *
+REmatch_resume(char *str,	/* string to test */
+	       size_t str_len,	/* ...its length */
+	       PTR machine,	/* compiled regular expression */
+	       size_t *lenp,	/* where to return matched-length */
+	       char *from,	/* where the search begins */
+	       char **partp)	/* where to return the partial match */
 {
     register STATE *m = (STATE *) machine;
-    char *s = str;
+    char *s = from;
     char *ss;
     register RT_STATE *stackp;
     int u_flag, t;
-    char *str_end = s + str_len;
+    char *str_end = str + str_len;
     RT_POS_ENTRY *sp;
     char *ts;
+    long budget;		/* states to push before giving up on this */
+    char *nul_lo = from;	/* there is no NUL in [from, nul_lo) */
+    char *nul_at = 0;		/* ...or this is the first one */
+    char **ends;		/* of the words an M_TRIE matches */
+    int cut;
+    int k;
 
     /* state of current best match stored here */
     char *cb_ss;		/* the start */
@@ -88,14 +132,22 @@ REmatch(char *str,		/* string to test */
     STATE *m_best = 0;
 
     *lenp = 0;
+    if (partp != 0)
+	*partp = str_end;
 
     /* check for the easy case */
-    if ((m + 1)->s_type == M_ACCEPT && m->s_type == M_STR) {
-	if ((ts = str_str(s, str_len, m->s_data.str, (size_t) m->s_len)))
+    if (m->s_type == M_STR && (m + 1)->s_type == M_ACCEPT) {
+	if ((ts = str_str(s, (size_t) (str_end - s),
+			  m->s_data.str, (size_t) m->s_len)))
 	    *lenp = m->s_len;
+	else
+	    cut_short(tail_of(s, (size_t) m->s_len));
 	return ts;
     }
 
+    if ((budget = RE_backtrack_limit(str_len)) == 0)
+	goto linear;
+
     u_flag = U_ON;
     cb_ss = ss = (char *) 0;
     stackp = RE_run_stack_empty;
@@ -130,6 +182,8 @@ REmatch(char *str,		/* string to test */
     switch (m->s_type + u_flag) {
     case M_STR + U_OFF + END_OFF:
 	if (strncmp(s, m->s_data.str, (size_t) m->s_len)) {
+	    if ((size_t) (str_end - s) < (size_t) m->s_len)
+		cut_short(ss ? ss : s);
 	    goto refill;
 	}
 	if (!ss) {
@@ -145,6 +199,8 @@ REmatch(char *str,		/* string to test */
 
     case M_STR + U_OFF + END_ON:
 	if (strcmp(s, m->s_data.str)) {
+	    if ((size_t) (str_end - s) < (size_t) m->s_len)
+		cut_short(ss ? ss : s);
 	    goto refill;
 	}
 	if (!ss) {
@@ -160,12 +216,22 @@ REmatch(char *str,		/* string to test */
 
     case M_STR + U_ON + END_OFF:
 	if (s >= str_end) {
+	    if (ss)
+		cut_short(ss);
 	    goto refill;
 	}
-	if (!(s = str_str(s, (size_t) (str_end - s), m->s_data.str, (size_t) m->s_len))) {
+	if (!(ts = str_str(s, (size_t) (str_end - s), m->s_data.str, (size_t) m->s_len))) {
+	    cut_short(ss ? ss : tail_of(s, (size_t) m->s_len));
 	    goto refill;
 	}
-	if (s >= str + strlen(str)) {
+	s = ts;
+	/* a match past an embedded NUL after from does not count; look for
+	   one only as far as the search has gone, to keep this linear */
+	if (nul_at == 0 && s >= nul_lo) {
+	    if ((nul_at = memchr(nul_lo, 0, (size_t) (s - nul_lo) + 1)) == 0)
+		nul_lo = s + 1;
+	}
+	if (nul_at != 0 && s >= nul_at) {
 	    goto refill;
 	}
 	push(m, s + 1, sp, ss, U_ON);
@@ -182,6 +248,7 @@ REmatch(char *str,		/* string to test */
 	goto reswitch;
 
     case M_STR + U_ON + END_ON:
+	cut_short(ss ? ss : tail_of(s, (size_t) m->s_len));
 	t = (int) ((str_end - s) - m->s_len);
 	if (t < 0 || memcmp(ts = s + t, m->s_data.str, (size_t) m->s_len)) {
 	    goto refill;
@@ -199,8 +266,10 @@ REmatch(char *str,		/* string to test */
 	goto reswitch;
 
     case M_CLASS + U_OFF + END_OFF:
-	if (s >= str_end)
+	if (s >= str_end) {
+	    cut_short(ss ? ss : s);
 	    goto refill;
+	}
 	if (!ison(*m->s_data.bvp, s[0])) {
 	    goto refill;
 	}
@@ -216,8 +285,10 @@ REmatch(char *str,		/* string to test */
 	goto reswitch;
 
     case M_CLASS + U_OFF + END_ON:
-	if (s >= str_end)
+	if (s >= str_end) {
+	    cut_short(ss ? ss : s);
 	    goto refill;
+	}
 	if (s[1] || !ison(*m->s_data.bvp, s[0])) {
 	    goto refill;
 	}
@@ -233,15 +304,9 @@ REmatch(char *str,		/* string to test */
 	goto reswitch;
 
     case M_CLASS + U_ON + END_OFF:
-	if (s >= str_end)
-	    goto refill;
-	while (!ison(*m->s_data.bvp, s[0])) {
-	    if (s >= str_end) {
-		goto refill;
-	    } else {
-		s++;
-	    }
-	}
+	if (ss)
+	    cut_short(ss);
+	s = RE_class_scan((SCAN_BV *) m->s_data.bvp, s, str_end);
 	if (s >= str_end) {
 	    goto refill;
 	}
@@ -259,6 +324,8 @@ REmatch(char *str,		/* string to test */
 	goto reswitch;
 
     case M_CLASS + U_ON + END_ON:
+	if (ss)
+	    cut_short(ss);
 	if ((s >= str_end) || !ison(*m->s_data.bvp, str_end[-1])) {
 	    goto refill;
 	}
@@ -276,6 +343,7 @@ REmatch(char *str,		/* string to test */
 
     case M_ANY + U_OFF + END_OFF:
 	if (s >= str_end) {
+	    cut_short(ss ? ss : s);
 	    goto refill;
 	}
 	if (!ss) {
@@ -290,7 +358,11 @@ REmatch(char *str,		/* string to test */
 	goto reswitch;
 
     case M_ANY + U_OFF + END_ON:
-	if ((s >= str_end) || ((s + 1) < str_end)) {
+	if (s >= str_end) {
+	    cut_short(ss ? ss : s);
+	    goto refill;
+	}
+	if ((s + 1) < str_end) {
 	    goto refill;
 	}
 	if (!ss) {
@@ -305,6 +377,8 @@ REmatch(char *str,		/* string to test */
 	goto reswitch;
 
     case M_ANY + U_ON + END_OFF:
+	if (ss)
+	    cut_short(ss);
 	if (s >= str_end) {
 	    goto refill;
 	}
@@ -322,6 +396,8 @@ REmatch(char *str,		/* string to test */
 	goto reswitch;
 
     case M_ANY + U_ON + END_ON:
+	if (ss)
+	    cut_short(ss);
 	if (s >= str_end) {
 	    goto refill;
 	}
@@ -372,6 +448,8 @@ REmatch(char *str,		/* string to test */
 	goto reswitch;
 
     case M_END + U_ON:
+	if (ss)
+	    cut_short(ss);
 	s = str_end;
 	if (!ss) {
 	    if (cb_ss && s > cb_ss) {
@@ -384,6 +462,59 @@ REmatch(char *str,		/* string to test */
 	u_flag = U_OFF;
 	goto reswitch;
 
+    case M_TRIE + U_OFF:
+	if (!ss && cb_ss && s > cb_ss)
+	    goto refill;
+	t = RE_trie_walk(m->s_data.trie, s, str_end, &ends, &cut);
+	if (cut)
+	    cut_short(ss ? ss : s);
+	if (t == 0)
+	    goto refill;
+	if (!ss)
+	    ss = s;
+	/* go on after the longest word here, and push the others */
+	for (k = 0; k < t - 1; ++k)
+	    push(m + 1, ends[k], sp, ss, U_OFF);
+	s = ends[t - 1];
+	m++;
+	goto reswitch;
+
+    case M_TRIE + U_ON:
+	/* find the next place where a word begins */
+	for (;;) {
+	    if (!ss && cb_ss && s > cb_ss)
+		goto refill;
+	    s = RE_class_scan(&(m->s_data.trie->first), s, str_end);
+	    if (s >= str_end) {
+		if (ss)
+		    cut_short(ss);
+		goto refill;
+	    }
+	    t = RE_trie_walk(m->s_data.trie, s, str_end, &ends, &cut);
+	    if (cut)
+		cut_short(ss ? ss : s);
+	    if (t != 0)
+		break;
+	    s++;
+	}
+	/* as for M_STR, a match past a NUL does not count */
+	if (nul_at == 0 && s >= nul_lo) {
+	    if ((nul_at = memchr(nul_lo, 0, (size_t) (s - nul_lo) + 1)) == 0)
+		nul_lo = s + 1;
+	}
+	if (nul_at != 0 && s >= nul_at) {
+	    goto refill;
+	}
+	push(m, s + 1, sp, ss, U_ON);
+	if (!ss)
+	    ss = s;
+	for (k = 0; k < t - 1; ++k)
+	    push(m + 1, ends[k], sp, ss, U_OFF);
+	s = ends[t - 1];
+	m++;
+	u_flag = U_OFF;
+	goto reswitch;
+
       CASE_UANY(M_U):
 	if (!ss) {
 	    if (cb_ss && s > cb_ss) {
@@ -439,6 +570,7 @@ REmatch(char *str,		/* string to test */
 	if (!ss) {
 	    ss = s;
 	} else {
+	    cut_short(ss);
 	    s = str_end;
 	}
 
@@ -453,5 +585,11 @@ REmatch(char *str,		/* string to test */
     default:
 	RE_panic("unexpected case in REmatch");
     }
+
+  linear:
+    /* backtracking has taken too long, or is not wanted */
+    return RE_pike_match(str, str_len, (STATE *) machine, lenp, from, partp);
 }
 #undef push
+#undef cut_short
+#undef tail_of
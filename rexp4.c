@@ -17,14 +17,23 @@ the GNU General Public License, version 2, 1991.
 #include "rexp.h"
 #include "field.h"
 
+/*
+ * If the machine matches only a single string, return it.  Only the
+ * built-in matcher's machines can be examined.
+ */
 char *
 is_string_split(PTR q, unsigned *lenp)
 {
+#ifdef LOCAL_REGEXP
     STATE *p = (STATE *) q;
 
     if (p != 0 && (p[0].s_type == M_STR && p[1].s_type == M_ACCEPT)) {
 	*lenp = p->s_len;
 	return p->s_data.str;
-    } else
-	return (char *) 0;
+    }
+#else
+    (void) q;
+    (void) lenp;
+#endif
+    return (char *) 0;
 }
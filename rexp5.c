@@ -0,0 +1,1513 @@
+/********************************************
+rexp5.c
+copyright 2026, Thomas E. Dickey
+
+This is a source file for mawk, an implementation of
+the AWK programming language.
+
+Mawk is distributed without warranty under the terms of
+the GNU General Public License, version 2, 1991.
+********************************************/
+
+/*
+ * $MawkId: rexp5.c,v 1.1 2026/10/16 00:00:00 tom Exp $
+ */
+
+/*
+ * A lazily built DFA for REtest().
+ *
+ * REtest() only has to say whether a match exists, so rather than
+ * backtracking it can follow every path through the machine at once.
+ * A path is an "item", the index of a STATE which is waiting for input:
+ *
+ *	M_STR		waiting for character k of the string
+ *	M_CLASS, M_ANY	waiting for one character
+ *	M_END		waiting for the end of the string
+ *
+ * plus the u_flag of REtest(), which lets the item skip any characters
+ * before it matches.  A state which has matched, but is marked END_ON,
+ * leaves an item waiting for the end of the string, at k = s_len (or 1).
+ *
+ * A DSTATE is a sorted set of items.  Its transitions are made the first
+ * time they are needed, indexed by classes of bytes which no STATE
+ * distinguishes, so the test costs one table lookup per byte.  A state
+ * which only a few bytes can leave, e.g., while looking for the first
+ * character of a match, skips to the next of those with memchr().
+ *
+ * If the states of one machine need more than DFA_MEMORY bytes, they are
+ * discarded and that machine is left to the backtracking interpreter.
+ * So is a machine without alternatives or closures, which it handles
+ * in one pass anyway, and one with an M_TRIE, which it walks.
+ *
+ * The table of machines also holds the literal which REcompile() found
+ * that every match must contain, see RE_set_must().
+ *
+ * The same DFA also tests a set of machines at once, see REset().
+ *
+ * Once a machine has been tested JIT_USES times, its states are translated
+ * to native code where that is supported, see rexp6.c, and again each
+ * JIT_USES times after that if more states were made meanwhile.  By
+ * default that is done only for a machine which has stepped through at
+ * least one byte in JIT_STEPS of the strings it was given, one at a time:
+ * the code is faster there, but no faster than memchr() and the other
+ * skips, and calling it costs more for short strings.  -W re_jit=0 or 1
+ * turns the translation off, or on for every machine.
+ */
+
+#include "rexp.h"
+#include <ctype.h>
+#include <limits.h>
+
+#if defined(__SSE2__)
+#define USE_SSE2_SKIP 1
+#include <emmintrin.h>
+#else
+#define USE_SSE2_SKIP 0
+#endif
+
+#define DFA_MEMORY	(1L << 20)	/* bytes of DSTATEs for one machine */
+#define DFA_SET_MEMORY	(1L << 24)	/* bytes of DSTATEs for a set */
+#define DFA_BUCKETS	256	/* machines, hashed by address */
+
+/* an item is a STATE index, an offset into M_STR, and the u_flag */
+#define ITEM(pc,k,u)	((((pc) << 8) + (k)) * 2 + (u))
+#define ITEM_PC(n)	((n) >> 9)
+#define ITEM_K(n)	(((n) >> 1) & 0xff)
+#define ITEM_U(n)	((n) & 1)
+
+#define JIT_USES	100	/* tests of a machine before its DFA is translated */
+#define JIT_STATES	1024	/* ...if it has no more states than this */
+#define JIT_SKIP	8	/* skips shorter than this are left to the code */
+#define JIT_STEPS	4	/* ...by default, if it stepped at least 1 byte in 4 */
+
+#define MAX_SKIP	3
+#define SKIP_CLASS	(MAX_SKIP + 1)	/* the bytes which leave are in scan */
+
+/* where a closure is made */
+#define AT_START	1
+#define AT_END		2
+
+typedef struct dstate {
+    struct dstate *link;	/* next with the same hash */
+    int *items;			/* sorted */
+    int count;			/* number of items */
+    int flags;
+    unsigned hash;
+    int nskip;			/* bytes in skip[], or -1 if not known */
+    UChar skip[MAX_SKIP];	/* the only bytes which leave this state */
+    SCAN_BV *scan;		/* ...or a class of them, if more */
+    int ndecided;		/* for a set, members which matched */
+    int *at_end;		/* ...and the count and list at the end */
+    int jit;			/* the state in the native code, or -1 */
+    unsigned long skips;	/* times skipped through, and the bytes */
+    unsigned long skipped;
+} DSTATE;
+
+/* the transitions follow the DSTATE, by byte class, null until needed */
+#define NEXT(ds)	((DSTATE **) ((ds) + 1))
+
+#define DS_ACCEPT	1	/* reached M_ACCEPT, the test succeeds */
+#define DS_DEAD		2	/* no items left, the test fails */
+#define DS_SPECIAL	(DS_ACCEPT | DS_DEAD)
+#define DS_AT_END	4	/* the result at the end of string is known */
+#define DS_END_OK	8	/* ...and it succeeds */
+
+typedef struct dfa {
+    struct dfa *link;		/* next with the same hash */
+    STATE *machine;
+    char *must;			/* a string which every match contains */
+    size_t must_len;
+    int must_fold;		/* ...ignoring case, see fold_str() */
+    UChar must_ends[4];		/* bytes which may begin and end it */
+    int ready;			/* dfa_init() was called */
+    int failed;			/* use REtest()'s interpreter instead */
+    int has_end;		/* uses $, which REtest() finds with strlen */
+    int nstates;		/* STATEs in machine, through M_ACCEPT */
+    int nclasses;		/* distinct byte classes */
+    UChar classes[256];
+    DSTATE *start;
+    DSTATE **table;		/* DSTATEs, hashed by items */
+    unsigned table_size;	/* a power of two */
+    unsigned count;		/* DSTATEs in table */
+    size_t memory;		/* bytes used by DSTATEs */
+    unsigned *marks;		/* STATE/u_flag pairs seen in a closure */
+    unsigned mark;
+    int *stack;			/* for making closures */
+    int *items;			/* items of the DSTATE being made */
+    int nitems;
+    int max_items;
+    int accept;			/* a closure reached M_ACCEPT */
+    /* the rest is used only for a set of machines, see REset() */
+    int members;		/* machines in the set */
+    int *owner;			/* member for each STATE */
+    UChar *is_base;		/* STATEs which are items of the start */
+    int *base_first;		/* per member, index into base_items */
+    int *base_items;		/* items of the start, with u_flag on */
+    int *entry;			/* per member, its first STATE */
+    unsigned *member_marks;	/* members which have matched */
+    unsigned member_mark;
+    size_t limit;		/* DFA_MEMORY, or more for a set */
+    size_t scanned;		/* bytes tested since the states were made */
+    unsigned uses;		/* calls to RE_dfa_test() */
+#if USE_JIT
+    unsigned long bytes;	/* ...the length of their strings */
+    unsigned long steps;	/* ...and the bytes stepped through one by one */
+    JIT *jit;			/* native code for the DSTATEs */
+    DSTATE **jit_states;	/* ...indexed by their jit */
+    unsigned jit_count;		/* DSTATEs when it was made */
+#endif
+} DFA;
+
+static DFA *dfa_list[DFA_BUCKETS];
+static DFA *dfa_last;		/* most recently used */
+
+int RE_jit_flag = -1;		/* 0 or 1 to force, else where it is faster */
+
+#define DFA_HASH(m)	((unsigned) (((size_t) (m)) >> 4) % DFA_BUCKETS)
+
+static void
+dfa_clear(DFA * dfa)
+{
+    unsigned n;
+    DSTATE *p, *q;
+
+#if USE_JIT
+    if (dfa->jit != 0) {
+	RE_jit_free(dfa->jit);
+	RE_free(dfa->jit_states);
+	dfa->jit = 0;
+	dfa->jit_states = 0;
+    }
+#endif
+    if (dfa->table != 0) {
+	for (n = 0; n < dfa->table_size; ++n) {
+	    for (p = dfa->table[n]; p != 0; p = q) {
+		q = p->link;
+		if (p->at_end)
+		    RE_free(p->at_end);
+		if (p->scan)
+		    RE_free(p->scan);
+		RE_free(p);
+	    }
+	}
+	RE_free(dfa->table);
+	dfa->table = 0;
+    }
+    dfa->start = 0;
+    dfa->count = 0;
+    dfa->memory = 0;
+}
+
+static void
+dfa_fail(DFA * dfa)
+{
+    TRACE(("RE_dfa: %p falls back after %u states\n",
+	   (void *) dfa->machine, dfa->count));
+    dfa_clear(dfa);
+    if (dfa->marks) {
+	RE_free(dfa->marks);
+	dfa->marks = 0;
+    }
+    if (dfa->stack) {
+	RE_free(dfa->stack);
+	dfa->stack = 0;
+    }
+    if (dfa->items) {
+	RE_free(dfa->items);
+	dfa->items = 0;
+    }
+    dfa->failed = 1;
+}
+
+static int
+add_item(DFA * dfa, int item)
+{
+    if (dfa->nitems == dfa->max_items) {
+	int want = dfa->max_items ? (2 * dfa->max_items) : 64;
+	int *items = (int *) realloc(dfa->items, (size_t) want * sizeof(int));
+
+	if (items == 0)
+	    return 0;
+	dfa->items = items;
+	dfa->max_items = want;
+    }
+    dfa->items[dfa->nitems++] = item;
+    return 1;
+}
+
+/*
+ * Add the items reachable from STATE pc, with u_flag u, without reading
+ * a character.  "where" says whether ^ or $ can match here.
+ */
+static int
+dfa_closure(DFA * dfa, int pc, int u, int where)
+{
+    STATE *m = dfa->machine;
+    int sp = 0;
+    int type;
+    int end;
+
+#define PUSH(p,f) do { \
+	    int n_ = (p) * 2 + (f); \
+	    if (dfa->marks[n_] != dfa->mark) { \
+		dfa->marks[n_] = dfa->mark; \
+		dfa->stack[sp++] = n_; \
+	    } \
+	} while (0)
+
+    PUSH(pc, u);
+    while (sp != 0) {
+	pc = dfa->stack[--sp];
+	u = pc & 1;
+	pc >>= 1;
+
+	type = m[pc].s_type;
+	end = (type >= END_ON);
+	if (end)
+	    type -= END_ON;
+
+	switch (type) {
+	case M_STR:
+	case M_CLASS:
+	case M_ANY:
+	    if (!(where & AT_END) && !add_item(dfa, ITEM(pc, 0, u)))
+		return 0;
+	    break;
+	case M_END:
+	    if (where & AT_END)
+		PUSH(pc + 1, 0);
+	    else if (!add_item(dfa, ITEM(pc, 0, u)))
+		return 0;
+	    break;
+	case M_START:
+	    if (where & AT_START) {
+		if (!end || (where & AT_END))
+		    PUSH(pc + 1, 0);
+		else if (!add_item(dfa, ITEM(pc, 1, 0)))
+		    return 0;
+	    }
+	    break;
+	case M_U:
+	    PUSH(pc + 1, 1);
+	    break;
+	case M_1J:
+	    PUSH(pc + m[pc].s_data.jump, u);
+	    break;
+	case M_2JA:
+	case M_2JB:
+	case M_2JC:
+	    PUSH(pc + 1, u);
+	    PUSH(pc + m[pc].s_data.jump, u);
+	    break;
+	case M_SAVE_POS:
+	    PUSH(pc + 1, u);
+	    break;
+	case M_ACCEPT:
+	    if (dfa->members) {
+		int who = dfa->owner[pc];
+
+		if (dfa->member_marks[who] != dfa->member_mark) {
+		    dfa->member_marks[who] = dfa->member_mark;
+		    dfa->accept++;
+		}
+	    } else {
+		dfa->accept = 1;
+	    }
+	    break;
+	default:
+	    RE_panic("unexpected case in RE_dfa");
+	}
+    }
+#undef PUSH
+    return 1;
+}
+
+/* start a set of items */
+static void
+dfa_begin(DFA * dfa)
+{
+    dfa->nitems = 0;
+    dfa->accept = 0;
+    if (++dfa->mark == 0) {
+	memset(dfa->marks, 0, (size_t) (2 * dfa->nstates) * sizeof(unsigned));
+	dfa->mark = 1;
+    }
+}
+
+static int
+compare_items(const void *a, const void *b)
+{
+    int x = *(const int *) a;
+    int y = *(const int *) b;
+
+    return (x > y) - (x < y);
+}
+
+/*
+ * For a set, start marking the members which have matched: those which
+ * had in ds, and those whose M_ACCEPT the closures reach.
+ */
+static void
+set_mark(DFA * dfa, DSTATE * ds)
+{
+    int n;
+
+    if (++dfa->member_mark == 0) {
+	memset(dfa->member_marks, 0,
+	       (size_t) dfa->members * sizeof(unsigned));
+	dfa->member_mark = 1;
+    }
+    if (ds != 0) {
+	for (n = 0; n < ds->ndecided; ++n)
+	    dfa->member_marks[ds->items[ds->count + n]] = dfa->member_mark;
+    }
+}
+
+#define set_matched(dfa,who) \
+	((dfa)->member_marks[who] == (dfa)->member_mark)
+
+/*
+ * A DSTATE of a set leaves out the items of members which have matched,
+ * since nothing more is needed from them, and the items of the start,
+ * which every member which has not matched still has.  The members
+ * which have matched follow its items.
+ */
+static int
+set_decided(DFA * dfa, int *countp, int *ndecidedp)
+{
+    int *items = dfa->items;
+    int count = dfa->nitems;
+    int n, k;
+
+    for (n = k = 0; n < count; ++n) {
+	int item = items[n];
+	int pc = ITEM_PC(item);
+
+	if (set_matched(dfa, dfa->owner[pc]))
+	    continue;
+	if (ITEM_U(item) && ITEM_K(item) == 0 && dfa->is_base[pc])
+	    continue;
+	items[k++] = item;
+    }
+    dfa->nitems = k;
+    for (n = 0; n < dfa->members; ++n) {
+	if (set_matched(dfa, n) && !add_item(dfa, n))
+	    return 0;
+    }
+    *countp = k;
+    *ndecidedp = dfa->nitems - k;
+    return 1;
+}
+
+/* can a member which has not matched still match? */
+static int
+set_alive(DFA * dfa)
+{
+    int n;
+
+    for (n = 0; n < dfa->members; ++n) {
+	if (!set_matched(dfa, n)
+	    && dfa->base_first[n] != dfa->base_first[n + 1])
+	    return 1;
+    }
+    return 0;
+}
+
+/*
+ * Find the DSTATE for the items just collected, making it if needed.
+ * Return null if that would exceed DFA_MEMORY.
+ */
+static DSTATE *
+dfa_state(DFA * dfa)
+{
+    DSTATE *p;
+    int *items;
+    int count = dfa->nitems;
+    int ndecided = 0;
+    int flags = 0;
+    unsigned hash;
+    size_t size;
+    int n, k;
+
+    if (dfa->members) {
+	if (!set_decided(dfa, &count, &ndecided))
+	    return 0;
+	if (count == 0 && !set_alive(dfa))
+	    flags = DS_DEAD;
+    } else if (dfa->accept) {
+	flags = DS_ACCEPT;
+	count = 0;
+    } else if (count == 0) {
+	flags = DS_DEAD;
+    }
+    items = dfa->items;
+    if (count > 1) {
+	qsort(items, (size_t) count, sizeof(int), compare_items);
+	for (n = k = 1; n < count; ++n) {
+	    if (items[n] != items[k - 1])
+		items[k++] = items[n];
+	}
+	if (k != count) {
+	    /* the members which matched follow the items */
+	    memmove(items + k, items + count, (size_t) ndecided * sizeof(int));
+	    count = k;
+	}
+    }
+
+    hash = (unsigned) flags;
+    for (n = 0; n < count + ndecided; ++n)
+	hash = (hash * 31) + (unsigned) items[n];
+
+    for (p = dfa->table[hash & (dfa->table_size - 1)]; p != 0; p = p->link) {
+	if (p->hash == hash
+	    && (p->flags & DS_SPECIAL) == flags
+	    && p->count == count
+	    && p->ndecided == ndecided
+	    && !memcmp(p->items, items,
+		       (size_t) (count + ndecided) * sizeof(int)))
+	    return p;
+    }
+
+    size = sizeof(DSTATE)
+	+ (size_t) dfa->nclasses * sizeof(DSTATE *)
+	+ (size_t) (count + ndecided) * sizeof(int);
+    if (dfa->memory + size > dfa->limit
+	|| (p = (DSTATE *) malloc(size)) == 0)
+	return 0;
+    dfa->memory += size;
+
+    p->items = (int *) (NEXT(p) + dfa->nclasses);
+    p->count = count;
+    p->flags = flags;
+    p->hash = hash;
+    p->nskip = -1;
+    p->scan = 0;
+    p->ndecided = ndecided;
+    p->at_end = 0;
+    p->jit = -1;
+    p->skips = 0;
+    p->skipped = 0;
+    memset(NEXT(p), 0, (size_t) dfa->nclasses * sizeof(DSTATE *));
+    memcpy(p->items, items, (size_t) (count + ndecided) * sizeof(int));
+
+    /* keep chains short as the table fills */
+    if (++dfa->count > 2 * dfa->table_size) {
+	unsigned size2 = 2 * dfa->table_size;
+	DSTATE **table = (DSTATE **) calloc((size_t) size2, sizeof(DSTATE *));
+	DSTATE *q;
+	unsigned j;
+
+	if (table != 0) {
+	    for (j = 0; j < dfa->table_size; ++j) {
+		for (q = dfa->table[j]; q != 0; q = dfa->table[j]) {
+		    dfa->table[j] = q->link;
+		    q->link = table[q->hash & (size2 - 1)];
+		    table[q->hash & (size2 - 1)] = q;
+		}
+	    }
+	    RE_free(dfa->table);
+	    dfa->table = table;
+	    dfa->table_size = size2;
+	}
+    }
+    p->link = dfa->table[hash & (dfa->table_size - 1)];
+    dfa->table[hash & (dfa->table_size - 1)] = p;
+    return p;
+}
+
+/* add the items which follow item, on byte c */
+static int
+dfa_item(DFA * dfa, int item, int c)
+{
+    STATE *m = dfa->machine;
+    int pc = ITEM_PC(item);
+    int k = ITEM_K(item);
+    int u = ITEM_U(item);
+    int type = m[pc].s_type;
+    int end = (type >= END_ON);
+    int ok = 1;
+
+    if (end)
+	type -= END_ON;
+
+    switch (type) {
+    case M_STR:
+	if (k < m[pc].s_len) {
+	    if ((UChar) m[pc].s_data.str[k] == c) {
+		if (k + 1 < m[pc].s_len || end)
+		    ok = add_item(dfa, ITEM(pc, k + 1, 0));
+		else
+		    ok = dfa_closure(dfa, pc + 1, 0, 0);
+	    }
+	    if (ok && u)
+		ok = add_item(dfa, item);
+	}
+	break;
+    case M_CLASS:
+    case M_ANY:
+	if (k == 0) {
+	    if (type == M_ANY || ison(*m[pc].s_data.bvp, c)) {
+		if (end)
+		    ok = add_item(dfa, ITEM(pc, 1, 0));
+		else
+		    ok = dfa_closure(dfa, pc + 1, 0, 0);
+	    }
+	    if (ok && u)
+		ok = add_item(dfa, item);
+	}
+	break;
+    case M_END:
+	if (u)
+	    ok = add_item(dfa, item);
+	break;
+    }
+    return ok;
+}
+
+/* make the transition from ds on byte c */
+static DSTATE *
+dfa_step(DFA * dfa, DSTATE * ds, int c)
+{
+    DSTATE *result;
+    int n, k;
+
+    if (dfa->members)
+	set_mark(dfa, ds);
+    dfa_begin(dfa);
+    for (n = 0; n < ds->count; ++n) {
+	if (!dfa_item(dfa, ds->items[n], c))
+	    return 0;
+	if (dfa->accept && !dfa->members)
+	    break;
+    }
+    for (n = 0; n < dfa->members; ++n) {
+	if (set_matched(dfa, n))
+	    continue;
+	for (k = dfa->base_first[n]; k < dfa->base_first[n + 1]; ++k) {
+	    if (!dfa_item(dfa, dfa->base_items[k], c))
+		return 0;
+	}
+    }
+    if ((result = dfa_state(dfa)) != 0)
+	NEXT(ds)[dfa->classes[c]] = result;
+    return result;
+}
+
+/*
+ * Find the bytes which leave ds, which loops to itself.  If there are
+ * few enough, they are searched for directly, or as a class if there are
+ * fewer than half.
+ */
+static int
+dfa_accel(DFA * dfa, DSTATE * ds)
+{
+    SCAN_BV leave;
+    int c;
+    int n = 0;
+
+    memset(&leave, 0, sizeof(leave));
+    for (c = 0; c < 256; ++c) {
+	DSTATE *next = NEXT(ds)[dfa->classes[c]];
+
+	if (next == 0 && (next = dfa_step(dfa, ds, c)) == 0)
+	    return 0;
+	if (next != ds) {
+	    if (n < MAX_SKIP)
+		ds->skip[n] = (UChar) c;
+	    leave.bv[c >> 3] |= (UChar) (1 << (c & 7));
+	    ++n;
+	}
+    }
+    if (n > MAX_SKIP) {
+	if (n < 128
+	    && dfa->memory + sizeof(SCAN_BV) <= dfa->limit
+	    && (ds->scan = (SCAN_BV *) malloc(sizeof(SCAN_BV))) != 0) {
+	    dfa->memory += sizeof(SCAN_BV);
+	    RE_class_init(&leave);
+	    *(ds->scan) = leave;
+	    n = SKIP_CLASS;
+	} else {
+	    n = 0;
+	}
+    }
+    ds->nskip = n;
+    return 1;
+}
+
+/* find the next of two or three bytes which leave ds */
+static const UChar *
+dfa_skip(DSTATE * ds, const UChar * s, const UChar * str_end)
+{
+    int a = ds->skip[0];
+    int b = ds->skip[1];
+    int c = ds->skip[ds->nskip - 1];
+
+#if USE_SSE2_SKIP
+    __m128i va = _mm_set1_epi8((char) a);
+    __m128i vb = _mm_set1_epi8((char) b);
+    __m128i vc = _mm_set1_epi8((char) c);
+
+    while (str_end - s >= 16) {
+	__m128i x = _mm_loadu_si128((const __m128i *) (const void *) s);
+	int bits = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(x, va),
+						  _mm_or_si128(_mm_cmpeq_epi8(x, vb),
+							       _mm_cmpeq_epi8(x, vc))));
+
+	if (bits != 0)
+	    return s + __builtin_ctz((unsigned) bits);
+	s += 16;
+    }
+#endif
+    while (s != str_end && *s != a && *s != b && *s != c)
+	++s;
+    return s;
+}
+
+/* add the items which follow item at the end of the string */
+static int
+dfa_end_item(DFA * dfa, int item)
+{
+    STATE *m = dfa->machine;
+    int pc = ITEM_PC(item);
+    int type = m[pc].s_type;
+    int done;
+
+    if (type >= END_ON) {
+	type -= END_ON;
+	done = (ITEM_K(item) == ((type == M_STR) ? m[pc].s_len : 1));
+    } else {
+	done = (type == M_END);
+    }
+    return !done || dfa_closure(dfa, pc + 1, 0, AT_END);
+}
+
+/* does the string succeed if it ends in ds? */
+static int
+dfa_at_end(DFA * dfa, DSTATE * ds)
+{
+    int n;
+
+    if (!(ds->flags & DS_AT_END)) {
+	dfa_begin(dfa);
+	for (n = 0; n < ds->count && !dfa->accept; ++n) {
+	    if (!dfa_end_item(dfa, ds->items[n]))
+		return -1;
+	}
+	ds->flags |= DS_AT_END | (dfa->accept ? DS_END_OK : 0);
+    }
+    return (ds->flags & DS_END_OK) != 0;
+}
+
+/*
+ * For a set, list the members which match if the string ends in ds,
+ * after the count of them.
+ */
+static int *
+set_at_end(DFA * dfa, DSTATE * ds)
+{
+    int *list;
+    int count;
+    int n, k;
+
+    if (ds->at_end == 0) {
+	set_mark(dfa, ds);
+	dfa_begin(dfa);
+	count = ds->ndecided;
+	for (n = 0; n < ds->count; ++n) {
+	    if (!dfa_end_item(dfa, ds->items[n]))
+		return 0;
+	}
+	for (n = 0; n < dfa->members; ++n) {
+	    if (set_matched(dfa, n))
+		continue;
+	    for (k = dfa->base_first[n]; k < dfa->base_first[n + 1]; ++k) {
+		if (!dfa_end_item(dfa, dfa->base_items[k]))
+		    return 0;
+	    }
+	}
+	count += dfa->accept;
+	if ((list = (int *) malloc((size_t) (count + 1) * sizeof(int))) == 0)
+	    return 0;
+	list[0] = 0;
+	for (n = 0; n < dfa->members; ++n) {
+	    if (set_matched(dfa, n))
+		list[++list[0]] = n;
+	}
+	dfa->memory += (size_t) (count + 1) * sizeof(int);
+	ds->at_end = list;
+    }
+    return ds->at_end;
+}
+
+/* split the byte classes so that the bytes in "in" are apart */
+static void
+dfa_classes(DFA * dfa, BV * in, int *count)
+{
+    short remap[2 * 256];
+    int c, key;
+    int n = 0;
+
+    memset(remap, -1, sizeof(remap));
+    memset(count, 0, 256 * sizeof(int));
+    for (c = 0; c < 256; ++c) {
+	key = dfa->classes[c] * 2 + (ison(*in, c) != 0);
+	if (remap[key] < 0)
+	    remap[key] = (short) n++;
+	dfa->classes[c] = (UChar) remap[key];
+	count[remap[key]]++;
+    }
+    dfa->nclasses = n;
+}
+
+/*
+ * Refine the byte classes for the STATEs of machine m, through M_ACCEPT.
+ * Return the number of STATEs, or 0 if the DFA cannot run it.
+ */
+static int
+dfa_scan(DFA * dfa, STATE * m, int *count, int *branches)
+{
+    int pc, k;
+
+    for (pc = 0;; ++pc) {
+	int type = m[pc].s_type;
+
+	if (type >= END_ON) {
+	    type -= END_ON;
+	    dfa->has_end = 1;
+	}
+	if (type == M_ACCEPT)
+	    break;
+	if (pc >= (INT_MAX >> 10))
+	    return 0;
+	switch (type) {
+	case M_STR:
+	    /* REtest() compares these with strncmp() and str_str() */
+	    if (m[pc].s_len == 0
+		|| memchr(m[pc].s_data.str, 0, (size_t) m[pc].s_len))
+		return 0;
+	    for (k = 0; k < m[pc].s_len; ++k) {
+		int c = (UChar) m[pc].s_data.str[k];
+		int old = dfa->classes[c];
+
+		if (count[old] > 1) {
+		    count[old]--;
+		    count[dfa->nclasses] = 1;
+		    dfa->classes[c] = (UChar) dfa->nclasses++;
+		}
+	    }
+	    break;
+	case M_CLASS:
+	    dfa_classes(dfa, m[pc].s_data.bvp, count);
+	    /* REtest() tries each place the first class matches */
+	    if (pc != 0)
+		*branches = 1;
+	    break;
+	case M_END:
+	    dfa->has_end = 1;
+	    break;
+	case M_TRIE:
+	    /* its items would be the nodes of the trie */
+	    return 0;
+	case M_U:
+	case M_2JA:
+	case M_2JB:
+	case M_2JC:
+	    *branches = 1;
+	    break;
+	}
+    }
+    return pc + 1;
+}
+
+/* allocate the tables used to make DSTATEs */
+static int
+dfa_alloc(DFA * dfa)
+{
+    dfa->table_size = 64;
+    dfa->table = (DSTATE **) calloc((size_t) dfa->table_size, sizeof(DSTATE *));
+    if (dfa->marks == 0)
+	dfa->marks = (unsigned *) calloc((size_t) (2 * dfa->nstates),
+					 sizeof(unsigned));
+    if (dfa->stack == 0)
+	dfa->stack = (int *) malloc((size_t) (2 * dfa->nstates) * sizeof(int));
+    return (dfa->table != 0 && dfa->marks != 0 && dfa->stack != 0);
+}
+
+/* set up the DFA for a machine, or mark it as unsuitable */
+static void
+dfa_init(DFA * dfa)
+{
+    int count[256];
+    int branches = 0;
+
+    dfa->nclasses = 1;
+    memset(dfa->classes, 0, sizeof(dfa->classes));
+    count[0] = 256;
+    dfa->limit = DFA_MEMORY;
+
+    if ((dfa->nstates = dfa_scan(dfa, dfa->machine, count, &branches)) == 0) {
+	dfa->failed = 1;
+	return;
+    }
+
+    /* without alternatives, REtest() does not backtrack much, and finds
+       literals with str_str() */
+    if (!branches) {
+	dfa->failed = 1;
+	return;
+    }
+
+    if (!dfa_alloc(dfa)) {
+	dfa_fail(dfa);
+	return;
+    }
+
+    /* REtest() starts with u_flag on */
+    dfa_begin(dfa);
+    if (!dfa_closure(dfa, 0, 1, AT_START)
+	|| (dfa->start = dfa_state(dfa)) == 0)
+	dfa_fail(dfa);
+}
+
+static DFA *
+dfa_find(STATE * machine, int create)
+{
+    DFA *dfa;
+    unsigned h;
+
+    if (dfa_last != 0 && dfa_last->machine == machine)
+	return dfa_last;
+
+    h = DFA_HASH(machine);
+    for (dfa = dfa_list[h]; dfa != 0; dfa = dfa->link) {
+	if (dfa->machine == machine)
+	    return (dfa_last = dfa);
+    }
+
+    if (!create || (dfa = (DFA *) calloc((size_t) 1, sizeof(DFA))) == 0)
+	return 0;
+    dfa->machine = machine;
+    dfa->link = dfa_list[h];
+    dfa_list[h] = dfa;
+    return (dfa_last = dfa);
+}
+
+/*
+ * Find the bytes c for which tolower(c) is the lower-case c0, putting the
+ * first two in ends[].  Return the number found.
+ */
+static int
+fold_ends(int c0, UChar * ends)
+{
+    int c;
+    int n = 0;
+
+    for (c = 0; c < 256; ++c) {
+	if (tolower(c) == c0) {
+	    if (n < 2)
+		ends[n] = (UChar) c;
+	    ++n;
+	}
+    }
+    return n;
+}
+
+/* compare len bytes of s with the lower-case key, ignoring case */
+static int
+fold_eq(const UChar * s, const UChar * key, size_t len)
+{
+    size_t n;
+
+    for (n = 0; n < len; ++n) {
+	if (tolower(s[n]) != key[n])
+	    return 0;
+    }
+    return 1;
+}
+
+/*
+ * Like str_str(), but ignoring case.  The key is in lower case, and
+ * dfa->must_ends holds the bytes which may begin it (two) and end it (two).
+ */
+static char *
+fold_str(DFA * dfa, char *target, size_t len)
+{
+    const UChar *key = (const UChar *) dfa->must;
+    size_t key_len = dfa->must_len;
+    const UChar *s = (const UChar *) target;
+    const UChar *last;		/* the last place a match may begin */
+
+    if (key_len > len)
+	return 0;
+    last = s + (len - key_len);
+
+#if USE_SSE2_SKIP
+    if (dfa->must_fold > 1) {
+	const UChar *ends = dfa->must_ends;
+	__m128i h0 = _mm_set1_epi8((char) ends[0]);
+	__m128i h1 = _mm_set1_epi8((char) ends[1]);
+	__m128i t0 = _mm_set1_epi8((char) ends[2]);
+	__m128i t1 = _mm_set1_epi8((char) ends[3]);
+
+	/* test 16 places at once, by their first and last bytes */
+	while (last - s >= 16) {
+	    __m128i x = _mm_loadu_si128((const __m128i *) (const void *) s);
+	    __m128i y = _mm_loadu_si128((const __m128i *) (const void *)
+					(s + key_len - 1));
+	    int bits = _mm_movemask_epi8(_mm_and_si128(_mm_or_si128(_mm_cmpeq_epi8(x, h0),
+								    _mm_cmpeq_epi8(x, h1)),
+						       _mm_or_si128(_mm_cmpeq_epi8(y, t0),
+								    _mm_cmpeq_epi8(y, t1))));
+
+	    while (bits != 0) {
+		int n = __builtin_ctz((unsigned) bits);
+
+		if (fold_eq(s + n, key, key_len))
+		    return (char *) (s + n);
+		bits &= bits - 1;
+	    }
+	    s += 16;
+	}
+    }
+#endif
+    for (; s <= last; ++s) {
+	if (tolower(*s) == key[0] && fold_eq(s, key, key_len))
+	    return (char *) s;
+    }
+    return 0;
+}
+
+/*
+ * Remember a string which every match of the machine contains, so that
+ * REtest() and REmatch() can reject a string which does not contain it
+ * with str_str(), before running the machine.  If fold is set, the string
+ * is in lower case and the match ignores case.
+ */
+void
+RE_set_must(STATE * machine, char *must, size_t len, int fold)
+{
+    DFA *dfa;
+    size_t n;
+
+    if (len != 0
+	&& (dfa = dfa_find(machine, 1)) != 0
+	&& (dfa->must = (char *) malloc(len + 1)) != 0) {
+	memcpy(dfa->must, must, len);
+	dfa->must[len] = '\0';
+	dfa->must_len = len;
+	dfa->must_fold = 0;
+	for (n = 0; fold && n < len; ++n) {
+	    if (toupper((UChar) must[n]) != (UChar) must[n]) {
+		dfa->must_fold = 1;
+		break;
+	    }
+	}
+	/* the vector search needs at most two bytes for each end */
+	if (dfa->must_fold
+	    && fold_ends((UChar) must[0], dfa->must_ends) <= 2
+	    && fold_ends((UChar) must[len - 1], dfa->must_ends + 2) <= 2) {
+	    if (dfa->must_ends[1] == 0)
+		dfa->must_ends[1] = dfa->must_ends[0];
+	    if (dfa->must_ends[3] == 0)
+		dfa->must_ends[3] = dfa->must_ends[2];
+	    dfa->must_fold = 2;
+	}
+	TRACE(("RE_set_must %p \"%s\"%s\n", (void *) machine, dfa->must,
+	       dfa->must_fold ? " ignoring case" : ""));
+    }
+}
+
+/*
+ * Does str lack the string which every match of machine contains?  Then
+ * REtest() and REmatch() can fail without running the machine.
+ */
+int
+RE_lacks_must(STATE * machine, char *str, size_t len)
+{
+    DFA *dfa = dfa_find(machine, 0);
+
+    if (dfa == 0 || dfa->must == 0)
+	return 0;
+    if (dfa->must_fold)
+	return fold_str(dfa, str, len) == 0;
+    return str_str(str, len, dfa->must, dfa->must_len) == 0;
+}
+
+#if USE_JIT
+/*
+ * The native code skips through a DSTATE with this.  Where a class is
+ * left after only a few bytes, on average, the code's own loop is faster.
+ */
+static const UChar *
+dfa_jit_skip(const UChar * s, const UChar * str_end, void *arg)
+{
+    DSTATE *ds = (DSTATE *) arg;
+
+    if (ds->nskip == 1) {
+	s = (const UChar *) memchr(s, ds->skip[0], (size_t) (str_end - s));
+	return (s != 0) ? s : str_end;
+    } else if (ds->nskip == SKIP_CLASS) {
+	return (const UChar *) RE_class_scan(ds->scan,
+					     (char *) s,
+					     (char *) str_end);
+    }
+    return dfa_skip(ds, s, str_end);
+}
+
+/*
+ * Translate the DSTATEs of a machine to native code, first finding which
+ * of those which loop to themselves can skip ahead.
+ */
+static void
+dfa_jit(DFA * dfa)
+{
+    DSTATE **states;
+    DSTATE *ds;
+    int *next;
+    void **skip;
+    unsigned n;
+    int count = 0;
+    int i, c;
+
+    for (n = 0; n < dfa->table_size; ++n) {
+	for (ds = dfa->table[n]; ds != 0; ds = ds->link) {
+	    if (ds->nskip < 0 && !(ds->flags & DS_SPECIAL)) {
+		for (c = 0; c < dfa->nclasses; ++c) {
+		    if (NEXT(ds)[c] == ds)
+			break;
+		}
+		if (c < dfa->nclasses && !dfa_accel(dfa, ds)) {
+		    dfa_fail(dfa);
+		    return;
+		}
+	    }
+	}
+    }
+
+    if (dfa->jit != 0) {
+	RE_jit_free(dfa->jit);
+	RE_free(dfa->jit_states);
+	dfa->jit = 0;
+	dfa->jit_states = 0;
+    }
+    dfa->jit_count = dfa->count;
+    if (dfa->count > JIT_STATES)
+	return;
+
+    states = (DSTATE **) malloc((size_t) dfa->count * sizeof(DSTATE *));
+    next = (int *) calloc((size_t) dfa->count * 256, sizeof(int));
+    skip = (void **) calloc((size_t) dfa->count, sizeof(void *));
+    if (states != 0 && next != 0 && skip != 0) {
+	for (n = 0; n < dfa->table_size; ++n) {
+	    for (ds = dfa->table[n]; ds != 0; ds = ds->link) {
+		ds->jit = count;
+		states[count++] = ds;
+	    }
+	}
+	for (i = 0; i < count; ++i) {
+	    ds = states[i];
+	    if ((ds->nskip > 0 && ds->nskip <= MAX_SKIP)
+		|| (ds->nskip == SKIP_CLASS
+		    && ds->skips != 0
+		    && ds->skipped / ds->skips >= JIT_SKIP))
+		skip[i] = (void *) ds;
+	    for (c = 0; c < 256; ++c) {
+		DSTATE *to = NEXT(ds)[dfa->classes[c]];
+
+		next[256 * i + c] = ((to == 0)
+				     ? JIT_MISS
+				     : ((to->flags & DS_ACCEPT)
+					? JIT_ACCEPT
+					: ((to->flags & DS_DEAD)
+					   ? JIT_DEAD
+					   : to->jit)));
+	    }
+	}
+	if ((dfa->jit = RE_jit(count, next, skip, dfa_jit_skip)) != 0) {
+	    dfa->jit_states = states;
+	    states = 0;
+	}
+    }
+    if (dfa->jit == 0) {
+	for (i = 0; i < count; ++i)
+	    states[i]->jit = -1;
+    }
+    if (states != 0)
+	RE_free(states);
+    if (next != 0)
+	RE_free(next);
+    if (skip != 0)
+	RE_free(skip);
+}
+#endif
+
+/*
+ * Test str ~ /machine/ with the DFA.
+ * Return -1 if REtest() must use its interpreter instead.
+ */
+int
+RE_dfa_test(char *str, size_t len, STATE * machine)
+{
+    DFA *dfa;
+    DSTATE *ds;
+    DSTATE *next;
+    const UChar *classes;
+    const UChar *s = (const UChar *) str;
+    const UChar *str_end = s + len;
+
+    /* REtest() does ^ and $ differently for an empty string, and finds
+       $ with strlen() */
+    if (len == 0 || (dfa = dfa_find(machine, 1)) == 0)
+	return -1;
+    if (!dfa->ready) {
+	dfa->ready = 1;
+	dfa_init(dfa);
+    }
+    if (dfa->failed || (dfa->has_end && memchr(str, 0, len)))
+	return -1;
+
+    classes = dfa->classes;
+    ds = dfa->start;
+    if (ds->flags & DS_SPECIAL)
+	return (ds->flags & DS_ACCEPT) != 0;
+#if USE_JIT
+    dfa->bytes += len;
+    if (RE_jit_flag != 0
+	&& ++dfa->uses % JIT_USES == 0
+	&& dfa->count != dfa->jit_count
+	&& (RE_jit_flag > 0
+	    || dfa->jit != 0
+	    || dfa->steps * JIT_STEPS >= dfa->bytes)) {
+	dfa_jit(dfa);
+	if (dfa->failed)
+	    return -1;
+    }
+#endif
+    while (s != str_end) {
+#if USE_JIT
+	if (ds->jit >= 0 && dfa->jit != 0) {
+	    int to = RE_jit_run(dfa->jit, s, str_end, ds->jit, &s);
+
+	    if (to < 0)
+		return (to == JIT_ACCEPT);
+	    ds = dfa->jit_states[to];
+	    if (s == str_end)
+		break;
+	}
+#endif
+	if ((next = NEXT(ds)[classes[*s]]) == ds && ds->nskip != 0) {
+	    const UChar *from = s;
+
+	    if (ds->nskip < 0 && !dfa_accel(dfa, ds)) {
+		dfa_fail(dfa);
+		return -1;
+	    }
+	    if (ds->nskip == 1) {
+		s = (const UChar *) memchr(s, ds->skip[0], (size_t) (str_end - s));
+		if (s == 0)
+		    return dfa_at_end(dfa, ds);
+	    } else if (ds->nskip == SKIP_CLASS) {
+		s = (const UChar *) RE_class_scan(ds->scan,
+						  (char *) s + 1,
+						  (char *) str_end);
+	    } else if (ds->nskip > 1) {
+		s = dfa_skip(ds, s + 1, str_end);
+	    }
+	    if (ds->nskip > 0) {
+		ds->skips++;
+		ds->skipped += (unsigned long) (s - from);
+		continue;
+	    }
+	}
+	if (next == 0 && (next = dfa_step(dfa, ds, *s)) == 0) {
+	    dfa_fail(dfa);
+	    return -1;
+	}
+	if (next->flags & DS_SPECIAL)
+	    return (next->flags & DS_ACCEPT) != 0;
+	ds = next;
+	++s;
+#if USE_JIT
+	++dfa->steps;
+#endif
+    }
+    return dfa_at_end(dfa, ds);
+}
+
+/* the memory of the DFA made for machine, if any */
+size_t
+RE_dfa_size(STATE * machine)
+{
+    DFA *dfa;
+
+    for (dfa = dfa_list[DFA_HASH(machine)]; dfa != 0; dfa = dfa->link) {
+	if (dfa->machine == machine)
+	    return (sizeof(DFA)
+		    + dfa->memory
+		    + dfa->table_size * sizeof(DSTATE *));
+    }
+    return 0;
+}
+
+/* REdestroy() is discarding a machine */
+void
+RE_dfa_forget(STATE * machine)
+{
+    DFA **p;
+    DFA *dfa;
+
+    for (p = &dfa_list[DFA_HASH(machine)]; (dfa = *p) != 0; p = &dfa->link) {
+	if (dfa->machine == machine) {
+	    *p = dfa->link;
+	    dfa_fail(dfa);
+	    if (dfa->must)
+		RE_free(dfa->must);
+	    if (dfa_last == dfa)
+		dfa_last = 0;
+	    RE_free(dfa);
+	    break;
+	}
+    }
+}
+
+/* make the start of a set, which REset_test() enters for each string */
+static int
+set_start(DFA * dfa)
+{
+    int n;
+
+    set_mark(dfa, (DSTATE *) 0);
+    dfa_begin(dfa);
+    for (n = 0; n < dfa->members; ++n) {
+	if (dfa->entry[n] >= 0 && !dfa_closure(dfa, dfa->entry[n], 1, AT_START))
+	    return 0;
+    }
+    return (dfa->start = dfa_state(dfa)) != 0;
+}
+
+/*
+ * The DSTATEs of a set need more than its limit.  If they have been used
+ * for enough input, start over, else give up on the set.
+ */
+static void
+set_flush(DFA * dfa)
+{
+    TRACE(("REset: %p flushes %u states after %lu bytes\n",
+	   (void *) dfa, dfa->count, (unsigned long) dfa->scanned));
+    if (dfa->scanned < dfa->limit) {
+	dfa_fail(dfa);
+	return;
+    }
+    dfa_clear(dfa);
+    dfa->scanned = 0;
+    if (!dfa_alloc(dfa) || !set_start(dfa))
+	dfa_fail(dfa);
+}
+
+/* discard a set made by REset() */
+void
+REset_destroy(PTR set)
+{
+    DFA *dfa = (DFA *) set;
+
+    dfa_fail(dfa);
+    if (dfa->machine)
+	RE_free(dfa->machine);
+    if (dfa->owner)
+	RE_free(dfa->owner);
+    if (dfa->is_base)
+	RE_free(dfa->is_base);
+    if (dfa->entry)
+	RE_free(dfa->entry);
+    if (dfa->base_first)
+	RE_free(dfa->base_first);
+    if (dfa->base_items)
+	RE_free(dfa->base_items);
+    if (dfa->member_marks)
+	RE_free(dfa->member_marks);
+    RE_free(dfa);
+}
+
+/*
+ * Make a set of machines which REset_test() tests together, in one pass
+ * over a string.  The STATEs of the members are copied one after another,
+ * so that a DSTATE can follow all of them, and each STATE remembers its
+ * member, so that each M_ACCEPT counts for its own.
+ *
+ * A machine which the DFA cannot run is left out of the set, and its entry
+ * in machines[] is made null.  Return null if fewer than two are left.
+ */
+PTR
+REset(PTR * machines, int count)
+{
+    DFA *dfa;
+    int *sizes;
+    int counts[256];
+    int branches = 0;
+    int members = 0;
+    int total = 0;
+    int n, k, pc;
+
+    if (count < 2
+	|| (dfa = (DFA *) calloc((size_t) 1, sizeof(DFA))) == 0)
+	return 0;
+    if ((sizes = (int *) malloc((size_t) count * sizeof(int))) == 0) {
+	RE_free(dfa);
+	return 0;
+    }
+    dfa->nclasses = 1;
+    counts[0] = 256;
+    for (n = 0; n < count; ++n) {
+	sizes[n] = dfa_scan(dfa, (STATE *) machines[n], counts, &branches);
+	if (sizes[n] == 0 || total + sizes[n] >= (INT_MAX >> 10)) {
+	    machines[n] = 0;
+	} else {
+	    total += sizes[n];
+	    members++;
+	}
+    }
+    dfa->members = count;
+    dfa->nstates = total;
+    dfa->limit = DFA_SET_MEMORY;
+    dfa->machine = (STATE *) malloc((size_t) total * sizeof(STATE));
+    dfa->owner = (int *) malloc((size_t) total * sizeof(int));
+    dfa->is_base = (UChar *) calloc((size_t) total, sizeof(UChar));
+    dfa->entry = (int *) malloc((size_t) count * sizeof(int));
+    dfa->base_first = (int *) malloc((size_t) (count + 1) * sizeof(int));
+    dfa->member_marks = (unsigned *) calloc((size_t) count, sizeof(unsigned));
+    if (members < 2
+	|| dfa->machine == 0
+	|| dfa->owner == 0
+	|| dfa->is_base == 0
+	|| dfa->entry == 0
+	|| dfa->base_first == 0
+	|| dfa->member_marks == 0
+	|| !dfa_alloc(dfa)) {
+	RE_free(sizes);
+	REset_destroy((PTR) dfa);
+	return 0;
+    }
+
+    for (n = pc = 0; n < count; ++n) {
+	if (machines[n] == 0) {
+	    dfa->entry[n] = -1;
+	    continue;
+	}
+	memcpy(dfa->machine + pc, machines[n], (size_t) sizes[n] * sizeof(STATE));
+	dfa->entry[n] = pc;
+	for (k = 0; k < sizes[n]; ++k)
+	    dfa->owner[pc++] = n;
+    }
+    RE_free(sizes);
+
+    /* find the items which each member has until it matches */
+    set_mark(dfa, (DSTATE *) 0);
+    dfa_begin(dfa);
+    for (n = 0; n < count; ++n) {
+	dfa->base_first[n] = dfa->nitems;
+	if (dfa->entry[n] >= 0 && !dfa_closure(dfa, dfa->entry[n], 1, AT_START))
+	    break;
+    }
+    if (n < count
+	|| (dfa->base_items = (int *) malloc((size_t) (dfa->nitems + 1)
+					     * sizeof(int))) == 0) {
+	REset_destroy((PTR) dfa);
+	return 0;
+    }
+    for (n = k = 0; n < count; ++n) {
+	int first = dfa->base_first[n];
+	int last = (n + 1 < count) ? dfa->base_first[n + 1] : dfa->nitems;
+
+	dfa->base_first[n] = k;
+	while (first < last) {
+	    int item = dfa->items[first++];
+
+	    if (ITEM_U(item) && ITEM_K(item) == 0) {
+		dfa->base_items[k++] = item;
+		dfa->is_base[ITEM_PC(item)] = 1;
+	    }
+	}
+    }
+    dfa->base_first[count] = k;
+
+    if (!set_start(dfa)) {
+	REset_destroy((PTR) dfa);
+	return 0;
+    }
+    TRACE(("REset: %p has %d of %d machines, %d states, %d classes\n",
+	   (void *) dfa, members, count, total, dfa->nclasses));
+    return (PTR) dfa;
+}
+
+/*
+ * Test str against each machine of a set, setting result[n] to 1 if
+ * machine n matches, else to 0.  Return -1 if each must be tested with
+ * REtest() instead.
+ */
+int
+REset_test(PTR set, char *str, size_t len, char *result)
+{
+    DFA *dfa = (DFA *) set;
+    DSTATE *ds;
+    DSTATE *next;
+    const UChar *classes = dfa->classes;
+    const UChar *s = (const UChar *) str;
+    const UChar *str_end = s + len;
+    int *list;
+    int n;
+
+    if (len == 0 || dfa->failed || (dfa->has_end && memchr(str, 0, len)))
+	return -1;
+
+    dfa->scanned += len;
+    ds = dfa->start;
+    while (s != str_end && !(ds->flags & DS_DEAD)) {
+	if ((next = NEXT(ds)[classes[*s]]) == ds && ds->nskip != 0) {
+	    if (ds->nskip < 0 && !dfa_accel(dfa, ds)) {
+		set_flush(dfa);
+		return -1;
+	    }
+	    if (ds->nskip == 1) {
+		s = (const UChar *) memchr(s, ds->skip[0], (size_t) (str_end - s));
+		if (s == 0)
+		    break;
+		continue;
+	    } else if (ds->nskip == SKIP_CLASS) {
+		s = (const UChar *) RE_class_scan(ds->scan,
+						  (char *) s + 1,
+						  (char *) str_end);
+		continue;
+	    } else if (ds->nskip > 1) {
+		s = dfa_skip(ds, s + 1, str_end);
+		continue;
+	    }
+	}
+	if (next == 0 && (next = dfa_step(dfa, ds, *s)) == 0) {
+	    set_flush(dfa);
+	    return -1;
+	}
+	ds = next;
+	++s;
+    }
+    if ((list = set_at_end(dfa, ds)) == 0) {
+	set_flush(dfa);
+	return -1;
+    }
+    memset(result, 0, (size_t) dfa->members);
+    for (n = 1; n <= list[0]; ++n)
+	result[list[n]] = 1;
+    return 1;
+}
+
+#ifdef NO_LEAKS
+void
+RE_dfa_leaks(void)
+{
+    int n;
+
+    for (n = 0; n < DFA_BUCKETS; ++n) {
+	while (dfa_list[n] != 0)
+	    RE_dfa_forget(dfa_list[n]->machine);
+    }
+}
+#endif
@@ -0,0 +1,442 @@
+/********************************************
+rexp6.c
+copyright 2026, Thomas E. Dickey
+
+This is a source file for mawk, an implementation of
+the AWK programming language.
+
+Mawk is distributed without warranty under the terms of
+the GNU General Public License, version 2, 1991.
+********************************************/
+
+/*
+ * $MawkId: rexp6.c,v 1.1 2026/10/16 00:00:00 tom Exp $
+ */
+
+/*
+ * Native code for the DFA of rexp5.c, on x86-64.
+ *
+ * RE_jit() is given the transitions of the DFA's states on each byte, and
+ * translates each state into a block of code which reads the next byte
+ * and branches on it, through a tree of compares, to the block of the
+ * next state.  So the state is kept in the program counter, and a run of
+ * bytes which stays in one state is a loop of a few instructions.
+ *
+ * A state which the DFA skips through with memchr() or RE_class_scan()
+ * calls a function given with the states to do that, then branches on the
+ * byte where it stopped.
+ *
+ * The code returns to RE_dfa_test() where it needs help:  at the end of
+ * the string, and on a transition which is not made yet.  It returns the
+ * state and the position, from which RE_dfa_test() continues, calling the
+ * code again when it reaches a state which the code has.
+ *
+ * The generated function is
+ *
+ *	int code(const UChar *s, const UChar *str_end, int state,
+ *		 const UChar **stop);
+ *
+ * with s in %rdi, str_end in %rsi, state in %edx and stop in %rcx.
+ * It returns JIT_ACCEPT or JIT_DEAD, or the state where it stopped, with
+ * that position in *stop.
+ */
+
+#include "rexp.h"
+
+#if USE_JIT
+
+#include <sys/mman.h>
+
+#ifndef MAP_ANONYMOUS
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+#define JIT_RUNS	32	/* more runs of bytes than this use a table */
+#define JIT_CODE	(1L << 20)	/* bytes of code for one DFA */
+
+typedef int (*JIT_CODE_FN) (const UChar *, const UChar *, int, const UChar **);
+
+struct jit {
+    UChar *code;		/* the mapping */
+    size_t size;
+};
+
+/* a reference to a label, filled in when all are placed */
+typedef struct {
+    size_t pos;			/* of the 4 or 8 bytes to fill in */
+    int label;
+    int absolute;		/* an address in a table, not rel32 */
+} FIXUP;
+
+typedef struct {
+    UChar *buf;
+    size_t used;
+    size_t size;
+    long *labels;		/* offset of each label, or -1 */
+    int nlabels;
+    int max_labels;
+    FIXUP *fixups;
+    int nfixups;
+    int max_fixups;
+    int failed;			/* out of memory, or too big */
+} EMIT;
+
+/* the labels of each state, of the shared exits, then those made later */
+#define L_STATE(i)	(i)
+#define L_EXIT(n,i)	((n) + (i))
+#define L_MISS(n,i)	(2 * (n) + (i))
+#define L_ACCEPT(n)	(3 * (n))
+#define L_DEAD(n)	(3 * (n) + 1)
+#define L_TABLES(n)	(3 * (n) + 2)	/* the entry table */
+
+static void
+emit_bytes(EMIT * e, const UChar * bytes, size_t count)
+{
+    if (e->used + count > e->size) {
+	size_t size = e->size ? 2 * e->size : 4096;
+	UChar *buf;
+
+	while (size < e->used + count)
+	    size *= 2;
+	if (size > JIT_CODE || (buf = (UChar *) realloc(e->buf, size)) == 0) {
+	    e->failed = 1;
+	    return;
+	}
+	e->buf = buf;
+	e->size = size;
+    }
+    memcpy(e->buf + e->used, bytes, count);
+    e->used += count;
+}
+
+/* emit the bytes of a string literal */
+#define CODE(e,s)	emit_bytes(e, (const UChar *) s, sizeof(s) - 1)
+
+static void
+emit_imm32(EMIT * e, int value)
+{
+    UChar bytes[4];
+    unsigned u = (unsigned) value;
+
+    bytes[0] = (UChar) u;
+    bytes[1] = (UChar) (u >> 8);
+    bytes[2] = (UChar) (u >> 16);
+    bytes[3] = (UChar) (u >> 24);
+    emit_bytes(e, bytes, sizeof(bytes));
+}
+
+static int
+new_label(EMIT * e)
+{
+    if (e->nlabels == e->max_labels) {
+	int max = e->max_labels ? 2 * e->max_labels : 256;
+	long *labels = (long *) realloc(e->labels, (size_t) max * sizeof(long));
+
+	if (labels == 0) {
+	    e->failed = 1;
+	    return 0;
+	}
+	e->labels = labels;
+	e->max_labels = max;
+    }
+    e->labels[e->nlabels] = -1;
+    return e->nlabels++;
+}
+
+static void
+place_label(EMIT * e, int label)
+{
+    if (!e->failed)
+	e->labels[label] = (long) e->used;
+}
+
+/* refer to label, with 4 bytes of rel32 or 8 of an address */
+static void
+emit_ref(EMIT * e, int label, int absolute)
+{
+    static const UChar zeros[8];
+
+    if (e->nfixups == e->max_fixups) {
+	int max = e->max_fixups ? 2 * e->max_fixups : 1024;
+	FIXUP *fixups = (FIXUP *) realloc(e->fixups,
+					  (size_t) max * sizeof(FIXUP));
+
+	if (fixups == 0) {
+	    e->failed = 1;
+	    return;
+	}
+	e->fixups = fixups;
+	e->max_fixups = max;
+    }
+    e->fixups[e->nfixups].pos = e->used;
+    e->fixups[e->nfixups].label = label;
+    e->fixups[e->nfixups].absolute = absolute;
+    e->nfixups++;
+    emit_bytes(e, zeros, absolute ? 8 : 4);
+}
+
+static void
+emit_jmp(EMIT * e, int label)
+{
+    CODE(e, "\xe9");		/* jmp rel32 */
+    emit_ref(e, label, 0);
+}
+
+/* jcc rel32, where cc is the low nibble of the opcode */
+static void
+emit_jcc(EMIT * e, int cc, int label)
+{
+    UChar bytes[2];
+
+    bytes[0] = 0x0f;
+    bytes[1] = (UChar) (0x80 | cc);
+    emit_bytes(e, bytes, sizeof(bytes));
+    emit_ref(e, label, 0);
+}
+
+#define CC_B	0x2
+#define CC_AE	0x3
+
+/* return value, with the position in %rdi (less one if back) in *stop */
+static void
+emit_return(EMIT * e, int value, int back)
+{
+    if (back) {
+	CODE(e, "\x48\x8d\x47\xff");	/* lea -1(%rdi),%rax */
+	CODE(e, "\x48\x89\x01");	/* mov %rax,(%rcx) */
+    } else {
+	CODE(e, "\x48\x89\x39");	/* mov %rdi,(%rcx) */
+    }
+    CODE(e, "\xb8");		/* mov $value,%eax */
+    emit_imm32(e, value);
+    CODE(e, "\xc3");		/* ret */
+}
+
+/* jmp *table(,%rax|%rdx,8), for a table placed at label */
+static void
+emit_table_jmp(EMIT * e, int table, int index_rdx)
+{
+    CODE(e, "\x4c\x8d\x0d");	/* lea table(%rip),%r9 */
+    emit_ref(e, table, 0);
+    if (index_rdx) {
+	CODE(e, "\x41\xff\x24\xd1");	/* jmp *(%r9,%rdx,8) */
+    } else {
+	CODE(e, "\x41\xff\x24\xc1");	/* jmp *(%r9,%rax,8) */
+    }
+}
+
+/*
+ * Branch on the byte in %al to the labels of runs[lo..hi], each of which
+ * starts at the byte in first[].
+ */
+static void
+emit_tree(EMIT * e, const int *first, const int *target, int lo, int hi)
+{
+    while (lo < hi) {
+	int mid = (lo + hi + 1) / 2;
+	int right = new_label(e);
+	UChar bytes[2];
+
+	bytes[0] = 0x3c;	/* cmp $first,%al */
+	bytes[1] = (UChar) first[mid];
+	emit_bytes(e, bytes, sizeof(bytes));
+	emit_jcc(e, CC_AE, right);
+	emit_tree(e, first, target, lo, mid - 1);
+	place_label(e, right);
+	lo = mid;
+    }
+    emit_jmp(e, target[lo]);
+}
+
+/* mov $value,%rdx or %rax */
+static void
+emit_mov64(EMIT * e, const void *value, int rdx)
+{
+    if (rdx) {
+	CODE(e, "\x48\xba");	/* movabs $value,%rdx */
+    } else {
+	CODE(e, "\x48\xb8");	/* movabs $value,%rax */
+    }
+    emit_bytes(e, (const UChar *) value, (size_t) 8);
+}
+
+/*
+ * Translate nstates states.  next[256 * i + c] is the state which state i
+ * goes to on byte c, or JIT_MISS, JIT_ACCEPT or JIT_DEAD.  State i starts
+ * with s = skip_fn(s, str_end, skip[i]) if skip[i] is not null.
+ */
+JIT *
+RE_jit(int nstates, const int *next, void **skip, JIT_SKIP_FN skip_fn)
+{
+    EMIT emit;
+    EMIT *e = &emit;
+    int first[256];
+    int target[256];
+    int tables = 0;
+    int *table_of;
+    JIT *result = 0;
+    int i, c, n;
+
+    memset(e, 0, sizeof(*e));
+    if ((table_of = (int *) calloc((size_t) nstates + 1, sizeof(int))) == 0)
+	return 0;
+    for (n = 0; n <= L_TABLES(nstates); ++n)
+	new_label(e);
+
+    /* enter the code for state %edx */
+    CODE(e, "\x89\xd2");	/* mov %edx,%edx */
+    emit_table_jmp(e, L_TABLES(nstates), 1);
+
+    for (i = 0; i < nstates && !e->failed; ++i) {
+	const int *row = next + 256 * i;
+	int runs = 0;
+	int missed = 0;
+
+	place_label(e, L_STATE(i));
+	CODE(e, "\x48\x39\xf7");	/* cmp %rsi,%rdi */
+	emit_jcc(e, CC_AE, L_EXIT(nstates, i));
+	if (skip[i] != 0) {
+	    /* three pushes keep the stack aligned for the call */
+	    CODE(e, "\x51\x56\x57");	/* push %rcx; push %rsi; push %rdi */
+	    emit_mov64(e, &skip[i], 1);
+	    emit_mov64(e, &skip_fn, 0);
+	    CODE(e, "\xff\xd0");	/* call *%rax */
+	    CODE(e, "\x5f\x5e\x59");	/* pop %rdi; pop %rsi; pop %rcx */
+	    CODE(e, "\x48\x89\xc7");	/* mov %rax,%rdi */
+	    CODE(e, "\x48\x39\xf7");	/* cmp %rsi,%rdi */
+	    emit_jcc(e, CC_AE, L_EXIT(nstates, i));
+	}
+	CODE(e, "\x0f\xb6\x07");	/* movzbl (%rdi),%eax */
+	CODE(e, "\x48\xff\xc7");	/* inc %rdi */
+
+	for (c = 0; c < 256; ++c) {
+	    int label;
+
+	    switch (row[c]) {
+	    case JIT_MISS:
+		label = L_MISS(nstates, i);
+		missed = 1;
+		break;
+	    case JIT_ACCEPT:
+		label = L_ACCEPT(nstates);
+		break;
+	    case JIT_DEAD:
+		label = L_DEAD(nstates);
+		break;
+	    default:
+		label = L_STATE(row[c]);
+		break;
+	    }
+	    if (runs == 0 || target[runs - 1] != label) {
+		first[runs] = c;
+		target[runs++] = label;
+	    }
+	}
+	if (runs <= JIT_RUNS) {
+	    emit_tree(e, first, target, 0, runs - 1);
+	} else {
+	    table_of[i] = new_label(e);
+	    emit_table_jmp(e, table_of[i], 0);
+	    ++tables;
+	}
+	place_label(e, L_EXIT(nstates, i));
+	emit_return(e, i, 0);
+	if (missed) {
+	    place_label(e, L_MISS(nstates, i));
+	    emit_return(e, i, 1);
+	}
+    }
+    place_label(e, L_ACCEPT(nstates));
+    emit_return(e, JIT_ACCEPT, 0);
+    place_label(e, L_DEAD(nstates));
+    emit_return(e, JIT_DEAD, 0);
+
+    /* the tables of addresses, aligned */
+    while ((e->used & 7) != 0)
+	CODE(e, "\xcc");		/* int3 */
+    place_label(e, L_TABLES(nstates));
+    for (i = 0; i < nstates; ++i)
+	emit_ref(e, L_STATE(i), 1);
+    for (i = 0; i < nstates && tables != 0; ++i) {
+	const int *row = next + 256 * i;
+
+	if (table_of[i] == 0)
+	    continue;
+	place_label(e, table_of[i]);
+	for (c = 0; c < 256; ++c) {
+	    switch (row[c]) {
+	    case JIT_MISS:
+		emit_ref(e, L_MISS(nstates, i), 1);
+		break;
+	    case JIT_ACCEPT:
+		emit_ref(e, L_ACCEPT(nstates), 1);
+		break;
+	    case JIT_DEAD:
+		emit_ref(e, L_DEAD(nstates), 1);
+		break;
+	    default:
+		emit_ref(e, L_STATE(row[c]), 1);
+		break;
+	    }
+	}
+    }
+
+    if (!e->failed && (result = (JIT *) malloc(sizeof(JIT))) != 0) {
+	result->size = e->used;
+	result->code = (UChar *) mmap((void *) 0, result->size,
+				      PROT_READ | PROT_WRITE,
+				      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (result->code == (UChar *) MAP_FAILED) {
+	    free(result);
+	    result = 0;
+	} else {
+	    for (n = 0; n < e->nfixups; ++n) {
+		FIXUP *f = e->fixups + n;
+		long to = e->labels[f->label];
+
+		if (to < 0) {
+		    RE_panic("jit label not placed");
+		} else if (f->absolute) {
+		    UChar *address = result->code + to;
+		    memcpy(e->buf + f->pos, &address, sizeof(address));
+		} else {
+		    int rel = (int) (to - (long) (f->pos + 4));
+		    memcpy(e->buf + f->pos, &rel, sizeof(rel));
+		}
+	    }
+	    memcpy(result->code, e->buf, e->used);
+	    if (mprotect(result->code, result->size, PROT_READ | PROT_EXEC)) {
+		RE_jit_free(result);
+		result = 0;
+	    }
+	}
+    }
+    TRACE(("RE_jit: %d states, %lu bytes%s\n", nstates,
+	   (unsigned long) e->used, result ? "" : " failed"));
+
+    free(table_of);
+    free(e->buf);
+    free(e->labels);
+    free(e->fixups);
+    return result;
+}
+
+int
+RE_jit_run(JIT * jit, const UChar * s, const UChar * str_end, int state,
+	   const UChar ** stop)
+{
+    JIT_CODE_FN code;
+
+    /* ISO C has no conversion from an object pointer to a function */
+    memcpy(&code, &jit->code, sizeof(code));
+    return code(s, str_end, state, stop);
+}
+
+void
+RE_jit_free(JIT * jit)
+{
+    munmap((void *) jit->code, jit->size);
+    free(jit);
+}
+
+#endif /* USE_JIT */
@@ -0,0 +1,462 @@
+/********************************************
+rexp7.c
+copyright 2026, Thomas E. Dickey
+
+This is a source file for mawk, an implementation of
+the AWK programming language.
+
+Mawk is distributed without warranty under the terms of
+the GNU General Public License, version 2, 1991.
+********************************************/
+
+/*
+ * $MawkId: rexp7.c,v 1.1 2026/10/17 00:00:00 tom Exp $
+ */
+
+/*
+ * Run a machine in time proportional to its length times the length of
+ * the string, for REtest() and REmatch().
+ *
+ * Backtracking can try exponentially many paths, e.g., /(a|aa)*b/ against
+ * a long run of a's.  Instead, this follows every path at once, as the DFA
+ * of rexp5.c does, with the same items, but makes no states: each item is
+ * a "thread" which also holds where its match started.  Two threads which
+ * reach the same item at the same place in the string have the same future,
+ * so only the one which started first is kept.  Threads are kept in order
+ * of their starts, so that is the first one to reach the item.
+ *
+ * REmatch() wants the leftmost of the longest matches.  A new thread is
+ * started at each place until something matches; after that, threads which
+ * started later are dropped, and the others run until they die, since one
+ * of them may still find a match which starts earlier, or is longer.
+ *
+ * REtest() and REmatch_resume() call this when backtracking has pushed
+ * RE_backtrack states per byte of the string (more for short strings), or
+ * always if RE_backtrack is zero.
+ */
+
+#include "rexp.h"
+
+#define BACKTRACK_RATE	32	/* default for RE_backtrack */
+#define BACKTRACK_MIN	1024	/* states pushed for any string */
+
+int RE_backtrack = BACKTRACK_RATE;
+
+/* where a closure is made */
+#define PK_START	1
+#define PK_END		2
+
+typedef struct {
+    int pc;			/* STATE index */
+    int k;			/* offset into M_STR, or node of M_TRIE */
+    int u;			/* the u_flag */
+    char *ss;			/* start of the match */
+} THREAD;
+
+typedef struct {
+    STATE *machine;
+    char *str;			/* the string, for ^ */
+    char *str_end;
+    int *base;			/* per STATE, its first slot */
+    unsigned *marks;		/* slots in this step */
+    unsigned mark;
+    int nslots;
+    int *stack;			/* for making closures */
+    THREAD *next;		/* threads for the next character */
+    int nnext;
+    int test;			/* REtest(), which stops at any match */
+    char *best;			/* start of the best match */
+    char *best_end;
+    char *part;			/* for REmatch_resume() */
+} PIKE;
+
+static int *pike_base;
+static unsigned *pike_marks;
+static int *pike_stack;
+static THREAD *pike_threads[2];
+static int pike_states;		/* allocated sizes */
+static int pike_slots;
+
+/* each item has a slot, for u off and on */
+#define SLOT(pk,pc,k,u)	((pk)->base[pc] + 2 * (k) + (u))
+
+/* start a new step, which can reach any slot again */
+static void
+pike_begin(PIKE * pk)
+{
+    if (++pk->mark == 0) {
+	memset(pk->marks, 0, (size_t) pk->nslots * sizeof(unsigned));
+	pk->mark = 1;
+    }
+}
+
+static int
+pike_claim(PIKE * pk, int slot)
+{
+    if (pk->marks[slot] == pk->mark)
+	return 0;
+    pk->marks[slot] = pk->mark;
+    return 1;
+}
+
+static void
+pike_add(PIKE * pk, int pc, int k, int u, char *ss)
+{
+    if (pike_claim(pk, SLOT(pk, pc, k, u))) {
+	THREAD *t = pk->next + pk->nnext++;
+
+	t->pc = pc;
+	t->k = k;
+	t->u = u;
+	t->ss = ss;
+    }
+}
+
+/* note the start of a match which the end of the string cut short */
+static void
+pike_cut(PIKE * pk, char *ss)
+{
+    if (ss < pk->part)
+	pk->part = ss;
+}
+
+/* a match from ss to s: keep the leftmost, then the longest */
+static void
+pike_accept(PIKE * pk, char *ss, char *s, int u)
+{
+    if (u) {
+	pike_cut(pk, ss);
+	s = pk->str_end;
+    }
+    if (pk->best == 0 || ss < pk->best
+	|| (ss == pk->best && s > pk->best_end)) {
+	pk->best = ss;
+	pk->best_end = s;
+    }
+}
+
+/*
+ * Add the threads reachable from STATE pc, with u_flag u, at s without
+ * reading a character, as dfa_closure() does.  Return nonzero if REtest()
+ * can stop.
+ */
+static int
+pike_closure(PIKE * pk, int pc, int u, char *s, char *ss, int where)
+{
+    STATE *m = pk->machine;
+    int sp = 0;
+    int type;
+    int end;
+
+#define PUSH(p,f) do { \
+	    if (pike_claim(pk, SLOT(pk, p, 0, f))) \
+		pk->stack[sp++] = (p) * 2 + (f); \
+	} while (0)
+
+    PUSH(pc, u);
+    while (sp != 0) {
+	pc = pk->stack[--sp];
+	u = pc & 1;
+	pc >>= 1;
+
+	type = m[pc].s_type;
+	end = (type >= END_ON);
+	if (end)
+	    type -= END_ON;
+
+	switch (type) {
+	case M_STR:
+	    if (m[pc].s_len == 0 && !end) {
+		PUSH(pc + 1, 0);
+		break;
+	    }
+	    /* FALLTHRU */
+	case M_CLASS:
+	case M_ANY:
+	case M_END:
+	case M_TRIE:
+	    if (where & PK_END) {
+		if (type == M_END || (type == M_STR && m[pc].s_len == 0))
+		    PUSH(pc + 1, 0);
+	    } else {
+		/* the slot is already claimed */
+		THREAD *t = pk->next + pk->nnext++;
+
+		t->pc = pc;
+		t->k = 0;
+		t->u = u;
+		t->ss = ss;
+	    }
+	    break;
+	case M_START:
+	    if (where & PK_START) {
+		if (!end || (where & PK_END))
+		    PUSH(pc + 1, 0);
+		else
+		    pike_add(pk, pc, 1, 0, ss);
+	    }
+	    break;
+	case M_U:
+	    PUSH(pc + 1, 1);
+	    break;
+	case M_1J:
+	    PUSH(pc + m[pc].s_data.jump, u);
+	    break;
+	case M_2JA:
+	case M_2JB:
+	case M_2JC:
+	    PUSH(pc + 1, u);
+	    PUSH(pc + m[pc].s_data.jump, u);
+	    break;
+	case M_SAVE_POS:
+	    PUSH(pc + 1, u);
+	    break;
+	case M_ACCEPT:
+	    pike_accept(pk, ss, s, u);
+	    if (pk->test)
+		return 1;
+	    break;
+	default:
+	    RE_panic("unexpected case in RE_pike");
+	}
+    }
+#undef PUSH
+    return 0;
+}
+
+/* follow thread t over the character at s, as dfa_item() does */
+static int
+pike_step(PIKE * pk, THREAD * t, char *s)
+{
+    STATE *m = pk->machine + t->pc;
+    int type = m->s_type;
+    int end = (type >= END_ON);
+    int c = (UChar) s[0];
+    int k;
+
+    if (end)
+	type -= END_ON;
+
+    switch (type) {
+    case M_STR:
+	if (t->k < m->s_len && (UChar) m->s_data.str[t->k] == c) {
+	    if (t->k + 1 < m->s_len || end)
+		pike_add(pk, t->pc, t->k + 1, 0, t->ss);
+	    else if (pike_closure(pk, t->pc + 1, 0, s + 1, t->ss, 0))
+		return 1;
+	}
+	break;
+    case M_CLASS:
+    case M_ANY:
+	if (t->k == 0 && (type == M_ANY || ison(*m->s_data.bvp, c))) {
+	    if (end)
+		pike_add(pk, t->pc, 1, 0, t->ss);
+	    else if (pike_closure(pk, t->pc + 1, 0, s + 1, t->ss, 0))
+		return 1;
+	}
+	break;
+    case M_TRIE:
+	/* k is a node of the trie */
+	if ((k = RE_trie_next(m->s_data.trie, t->k, c)) != 0) {
+	    if (m->s_data.trie->flags[k] & TRIE_KIDS)
+		pike_add(pk, t->pc, k, 0, t->ss);
+	    if ((m->s_data.trie->flags[k] & TRIE_FINAL)
+		&& pike_closure(pk, t->pc + 1, 0, s + 1, t->ss, 0))
+		return 1;
+	}
+	break;
+    }
+    if (t->u)
+	pike_add(pk, t->pc, t->k, 1, t->ss);
+    return 0;
+}
+
+/* finish thread t at the end of the string, as dfa_end_item() does */
+static int
+pike_end(PIKE * pk, THREAD * t)
+{
+    STATE *m = pk->machine + t->pc;
+    int type = m->s_type;
+    int done;
+
+    if (type >= END_ON) {
+	type -= END_ON;
+	done = (t->k == ((type == M_STR) ? m->s_len : 1));
+    } else {
+	done = (type == M_END);
+    }
+    if (done)
+	return pike_closure(pk, t->pc + 1, 0, pk->str_end, t->ss, PK_END);
+    pike_cut(pk, t->ss);
+    return 0;
+}
+
+/* size the tables for machine, through M_ACCEPT */
+static void
+pike_alloc(PIKE * pk, STATE * machine)
+{
+    int nstates;
+    int nslots = 0;
+    int pc;
+
+    for (pc = 0;; ++pc) {
+	if (machine[pc].s_type % END_ON == M_ACCEPT)
+	    break;
+    }
+    nstates = pc + 1;
+    if (nstates > pike_states) {
+	pike_base = (int *) RE_realloc(pike_base,
+				       (size_t) nstates * sizeof(int));
+	pike_stack = (int *) RE_realloc(pike_stack,
+					(size_t) (2 * nstates) * sizeof(int));
+	pike_states = nstates;
+    }
+    for (pc = 0; pc < nstates; ++pc) {
+	pike_base[pc] = nslots;
+	if ((machine[pc].s_type % END_ON) == M_STR)
+	    nslots += 2 * (machine[pc].s_len + 1);
+	else if (machine[pc].s_type == M_TRIE)
+	    nslots += 2 * machine[pc].s_data.trie->nodes;
+	else
+	    nslots += 4;
+    }
+    if (nslots > pike_slots) {
+	pike_marks = (unsigned *) RE_realloc(pike_marks,
+					     (size_t) nslots * sizeof(unsigned));
+	pike_threads[0] = (THREAD *) RE_realloc(pike_threads[0],
+						(size_t) nslots * sizeof(THREAD));
+	pike_threads[1] = (THREAD *) RE_realloc(pike_threads[1],
+						(size_t) nslots * sizeof(THREAD));
+	pike_slots = nslots;
+    }
+    memset(pike_marks, 0, (size_t) nslots * sizeof(unsigned));
+
+    pk->machine = machine;
+    pk->base = pike_base;
+    pk->marks = pike_marks;
+    pk->mark = 0;
+    pk->nslots = nslots;
+    pk->stack = pike_stack;
+}
+
+/*
+ * Search str for machine, starting at from.  Return nonzero if REtest()
+ * can stop.
+ */
+static int
+pike_run(PIKE * pk, char *str, size_t len, char *from)
+{
+    THREAD *list = pike_threads[0];
+    int count = 0;
+    char *s = from;
+    int n;
+
+    pk->str = str;
+    pk->str_end = str + len;
+    pk->best = 0;
+    pk->best_end = 0;
+    pk->part = pk->str_end;
+
+    for (;;) {
+	pike_begin(pk);
+	pk->next = list;
+	pk->nnext = count;
+	for (n = 0; n < count; ++n)
+	    pike_claim(pk, SLOT(pk, list[n].pc, list[n].k, list[n].u));
+
+	/* a match may start here, unless one has started already */
+	if (pk->best == 0
+	    && pike_closure(pk, 0, 0, s, s, (s == str) ? PK_START : 0))
+	    return 1;
+	count = pk->nnext;
+
+	if (s == pk->str_end)
+	    break;
+	if (count == 0 && pk->best != 0)
+	    return 0;
+
+	pike_begin(pk);
+	pk->next = (list == pike_threads[0]) ? pike_threads[1] : pike_threads[0];
+	pk->nnext = 0;
+	for (n = 0; n < count; ++n) {
+	    /* threads are in order of their starts */
+	    if (pk->best != 0 && list[n].ss > pk->best)
+		break;
+	    if (pike_step(pk, list + n, s))
+		return 1;
+	}
+	list = pk->next;
+	count = pk->nnext;
+	++s;
+    }
+
+    pike_begin(pk);
+    for (n = 0; n < count; ++n) {
+	if (pk->best != 0 && list[n].ss > pk->best)
+	    break;
+	if (pike_end(pk, list + n))
+	    return 1;
+    }
+    return 0;
+}
+
+/* REtest() without backtracking */
+int
+RE_pike_test(char *str, size_t len, STATE * machine)
+{
+    PIKE pk;
+
+    TRACE(("RE_pike_test %p\n", (void *) machine));
+    pike_alloc(&pk, machine);
+    pk.test = 1;
+    return pike_run(&pk, str, len, str);
+}
+
+/* REmatch_resume() without backtracking */
+char *
+RE_pike_match(char *str, size_t len, STATE * machine, size_t *lenp,
+	      char *from, char **partp)
+{
+    PIKE pk;
+
+    TRACE(("RE_pike_match %p\n", (void *) machine));
+    pike_alloc(&pk, machine);
+    pk.test = 0;
+    pike_run(&pk, str, len, from);
+    if (partp != 0)
+	*partp = pk.part;
+    *lenp = (pk.best != 0) ? (size_t) (pk.best_end - pk.best) : 0;
+    return pk.best;
+}
+
+/* the number of states backtracking may push for a string of len bytes */
+long
+RE_backtrack_limit(size_t len)
+{
+    if (RE_backtrack <= 0)
+	return 0;
+    return (long) BACKTRACK_MIN + (long) RE_backtrack * (long) len;
+}
+
+#ifdef NO_LEAKS
+void
+RE_pike_leaks(void)
+{
+    if (pike_base) {
+	RE_free(pike_base);
+	RE_free(pike_stack);
+	pike_base = 0;
+	pike_stack = 0;
+	pike_states = 0;
+    }
+    if (pike_marks) {
+	RE_free(pike_marks);
+	RE_free(pike_threads[0]);
+	RE_free(pike_threads[1]);
+	pike_marks = 0;
+	pike_threads[0] = 0;
+	pike_threads[1] = 0;
+	pike_slots = 0;
+    }
+}
+#endif
@@ -0,0 +1,287 @@
+/********************************************
+rexp8.c
+copyright 2026, Thomas E. Dickey
+
+This is a source file for mawk, an implementation of
+the AWK programming language.
+
+Mawk is distributed without warranty under the terms of
+the GNU General Public License, version 2, 1991.
+********************************************/
+
+/*
+ * $MawkId: rexp8.c,v 1.1 2026/10/17 00:00:00 tom Exp $
+ */
+
+/*
+ * Find where the groups in parentheses matched, for match(s, r, a).
+ *
+ * REmatch() finds the match without knowing about groups.  Its start and
+ * end are then fixed, and this searches only those bytes, with a second
+ * machine in which each group is between M_OPEN and M_CLOSE states.  The
+ * search is depth-first, trying alternatives in this order:
+ *
+ *	r|s	r, then s
+ *	r* r+	another r, then the rest
+ *	r?	r, then none
+ *	.*	another character, then the rest
+ *
+ * so that each group takes as much as it can, those on the left first.
+ * Whether a STATE can reach the end of the match from a place does not
+ * depend on the path taken to it, so each pair is tried once, and the
+ * search takes time proportional to the number of STATEs times the length
+ * of the match.
+ */
+
+#include "rexp.h"
+
+typedef struct {
+    STATE *machine;		/* with M_OPEN and M_CLOSE */
+    int nstates;		/* through M_ACCEPT */
+    int count;			/* groups */
+} GROUPS;
+
+/*
+ * An entry on the stack is a STATE to try at a place, or if pc is -1, a
+ * slot to restore when backing up.
+ */
+typedef struct {
+    int pc;
+    int u;			/* u_flag, or the slot */
+    char *s;
+} GR_ENTRY;
+
+static GR_ENTRY *gr_stack;
+static size_t gr_stack_size;
+static UChar *gr_tried;		/* a bit per STATE, u_flag and place */
+static size_t gr_tried_size;
+static char **gr_slots;		/* open and close of each group */
+static int gr_slots_size;
+
+PTR
+REgroups(char *re, size_t len)
+{
+    GROUPS *gp;
+    STATE *m;
+    int count;
+    int n;
+
+    if ((m = RE_compile_groups(re, len, &count)) == 0)
+	return 0;
+    for (n = 0; m[n].s_type != M_ACCEPT; ++n) {
+	;
+    }
+    gp = (GROUPS *) RE_malloc(sizeof(GROUPS));
+    gp->machine = m;
+    gp->nstates = n + 1;
+    gp->count = count;
+    return (PTR) gp;
+}
+
+int
+REgroups_count(PTR ptr)
+{
+    return ((GROUPS *) ptr)->count;
+}
+
+void
+REgroups_destroy(PTR ptr)
+{
+    GROUPS *gp = (GROUPS *) ptr;
+
+    REdestroy((PTR) gp->machine);
+    RE_free(gp);
+}
+
+#define TRIED(pc,u,s) \
+	(((size_t) (pc) * 2 + (size_t) (u)) * width + (size_t) ((s) - match))
+
+#define PUSH(p,f,t) do { \
+	    gr_stack[sp].pc = (p); \
+	    gr_stack[sp].u = (f); \
+	    gr_stack[sp].s = (t); \
+	    ++sp; \
+	} while (0)
+
+/*
+ * The match of ptr in str is the match_len bytes at match.  Set starts[]
+ * and lens[] to where each group matched, with a null start for one which
+ * did not.
+ */
+void
+REgroups_match(PTR ptr,
+	       char *str,
+	       size_t str_len,
+	       char *match,
+	       size_t match_len,
+	       char **starts,
+	       size_t *lens)
+{
+    GROUPS *gp = (GROUPS *) ptr;
+    STATE *m = gp->machine;
+    char *str_end = str + str_len;
+    char *end = match + match_len;
+    size_t width = match_len + 1;
+    size_t need;
+    size_t sp = 0;
+    int n;
+
+    TRACE(("REgroups_match %p\n", (void *) m));
+
+    need = ((size_t) gp->nstates * 2 * width + 7) / 8;
+    if (need > gr_tried_size) {
+	gr_tried = (UChar *) RE_realloc(gr_tried, need);
+	gr_tried_size = need;
+    }
+    memset(gr_tried, 0, need);
+    if (2 * gp->count > gr_slots_size) {
+	gr_slots = (char **) RE_realloc(gr_slots,
+					(size_t) (2 * gp->count) * sizeof(char *));
+	gr_slots_size = 2 * gp->count;
+    }
+    for (n = 0; n < 2 * gp->count; ++n)
+	gr_slots[n] = 0;
+
+    if (gr_stack_size == 0) {
+	gr_stack_size = 64;
+	gr_stack = (GR_ENTRY *) RE_malloc(gr_stack_size * sizeof(GR_ENTRY));
+    }
+
+    PUSH(0, 0, match);
+    while (sp != 0) {
+	GR_ENTRY *e = gr_stack + --sp;
+	int pc = e->pc;
+	int u = e->u;
+	char *s = e->s;
+	size_t bit;
+	int type;
+	int at_end;
+
+	if (pc < 0) {
+	    gr_slots[u] = s;
+	    continue;
+	}
+	bit = TRIED(pc, u, s);
+	if (gr_tried[bit >> 3] & (1 << (bit & 7)))
+	    continue;
+	gr_tried[bit >> 3] |= (UChar) (1 << (bit & 7));
+
+	/* each entry pushes at most three more */
+	if (sp + 3 > gr_stack_size) {
+	    gr_stack_size *= 2;
+	    gr_stack = (GR_ENTRY *) RE_realloc(gr_stack,
+					       gr_stack_size * sizeof(GR_ENTRY));
+	}
+
+	if (u) {
+	    /* after .*, skip a character, or stop skipping */
+	    PUSH(pc, 0, s);
+	    if (s < end)
+		PUSH(pc, 1, s + 1);
+	    continue;
+	}
+
+	type = m[pc].s_type;
+	at_end = (type >= END_ON);
+	if (at_end)
+	    type -= END_ON;
+
+	switch (type) {
+	case M_STR:
+	    if ((size_t) (end - s) >= (size_t) m[pc].s_len
+		&& !memcmp(s, m[pc].s_data.str, (size_t) m[pc].s_len)
+		&& (!at_end || s + m[pc].s_len == str_end))
+		PUSH(pc + 1, 0, s + m[pc].s_len);
+	    break;
+	case M_CLASS:
+	    if (s < end
+		&& ison(*m[pc].s_data.bvp, s[0])
+		&& (!at_end || s + 1 == str_end))
+		PUSH(pc + 1, 0, s + 1);
+	    break;
+	case M_ANY:
+	    if (s < end && (!at_end || s + 1 == str_end))
+		PUSH(pc + 1, 0, s + 1);
+	    break;
+	case M_START:
+	    if (s == str && (!at_end || s == str_end))
+		PUSH(pc + 1, 0, s);
+	    break;
+	case M_END:
+	    if (s == str_end)
+		PUSH(pc + 1, 0, s);
+	    break;
+	case M_U:
+	    PUSH(pc + 1, 1, s);
+	    break;
+	case M_1J:
+	    PUSH(pc + m[pc].s_data.jump, 0, s);
+	    break;
+	case M_2JA:
+	case M_2JB:
+	    /* the first pushed is tried last */
+	    PUSH(pc + m[pc].s_data.jump, 0, s);
+	    PUSH(pc + 1, 0, s);
+	    break;
+	case M_2JC:
+	    PUSH(pc + 1, 0, s);
+	    PUSH(pc + m[pc].s_data.jump, 0, s);
+	    break;
+	case M_SAVE_POS:
+	    PUSH(pc + 1, 0, s);
+	    break;
+	case M_OPEN:
+	case M_CLOSE:
+	    n = 2 * (m[pc].s_data.jump - 1) + (type == M_CLOSE);
+	    PUSH(-1, n, gr_slots[n]);
+	    gr_slots[n] = s;
+	    PUSH(pc + 1, 0, s);
+	    break;
+	case M_ACCEPT:
+	    if (s == end)
+		goto found;
+	    break;
+	default:
+	    RE_panic("unexpected case in REgroups_match");
+	}
+    }
+
+  found:
+    for (n = 0; n < gp->count; ++n) {
+	char *open = gr_slots[2 * n];
+	char *close = gr_slots[2 * n + 1];
+
+	if (sp != 0 && open != 0 && close != 0 && close >= open) {
+	    starts[n] = open;
+	    lens[n] = (size_t) (close - open);
+	} else {
+	    starts[n] = 0;
+	    lens[n] = 0;
+	}
+    }
+}
+
+#undef PUSH
+#undef TRIED
+
+#ifdef NO_LEAKS
+void
+RE_groups_leaks(void)
+{
+    if (gr_stack) {
+	RE_free(gr_stack);
+	gr_stack = 0;
+	gr_stack_size = 0;
+    }
+    if (gr_tried) {
+	RE_free(gr_tried);
+	gr_tried = 0;
+	gr_tried_size = 0;
+    }
+    if (gr_slots) {
+	RE_free(gr_slots);
+	gr_slots = 0;
+	gr_slots_size = 0;
+    }
+}
+#endif
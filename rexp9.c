@@ -0,0 +1,417 @@
+/********************************************
+rexp9.c
+copyright 2026, Thomas E. Dickey
+
+This is a source file for mawk, an implementation of
+the AWK programming language.
+
+Mawk is distributed without warranty under the terms of
+the GNU General Public License, version 2, 1991.
+********************************************/
+
+/*
+ * $MawkId: rexp9.c,v 1.1 2026/10/17 00:00:00 tom Exp $
+ */
+
+/*
+ * Compile an alternation of literals, e.g., a list of words joined by |,
+ * to a single M_TRIE state.
+ *
+ * RE_or() copies the machine it extends, so a list of n words takes time
+ * proportional to n * n to compile.  The DFA's states then hold an item per
+ * word, soon exceed DFA_MEMORY, and leave REtest() to try each word in turn
+ * at each place in the string.  Instead, REcompile() adds the words to a
+ * trie as it reads them, and matching walks the trie a byte at a time,
+ * however many words there are.  A walk finds each word which begins at a
+ * place, and the interpreters push all but the longest, as they would for
+ * the branches of the M_2JA states which RE_or() makes.
+ *
+ * A short list does better in the DFA, so RE_trie_done() turns a trie of
+ * TRIE_MIN words or fewer back into the machine RE_or() would have made.
+ * The DFA does not run a machine with an M_TRIE, see dfa_scan().  Neither
+ * does REgroups(), which wants the order of the alternatives, so tries are
+ * not made for it.
+ *
+ * When ignoring case, a letter is a class of its two cases.  A class which
+ * is exactly the bytes with one lower case adds that to the trie, and the
+ * walk looks up the lower case of each byte.
+ */
+
+#include "rexp.h"
+#include <ctype.h>
+
+#define TRIE_MIN	16	/* RE_or() is used for up to this many words */
+#define TRIE_NODES	(1 << 24)	/* most nodes, so that a key fits */
+
+#define TRIE_HASH(key)	(((key) * 2654435761U) ^ ((key) >> 7))
+
+#define trie_map(fold,c) ((fold) ? tolower(c) : (c))
+
+static char **trie_ends;	/* for RE_trie_walk() */
+static int trie_ends_size;
+
+/*
+ * If the class is the set of bytes which map to one byte, return that byte,
+ * else -1.
+ */
+static int
+trie_class(BV * bvp, int fold)
+{
+    int want = -1;
+    int c;
+
+    if (ison(*bvp, 0))
+	return -1;
+    for (c = 1; c < 256; ++c) {
+	if (ison(*bvp, c)) {
+	    want = trie_map(fold, c);
+	    break;
+	}
+    }
+    if (want <= 0)
+	return -1;
+    for (c = 1; c < 256; ++c) {
+	if (!ison(*bvp, c) != (trie_map(fold, c) != want))
+	    return -1;
+    }
+    return want;
+}
+
+/* nonzero if machine m matches only one string, which is not empty */
+static int
+trie_word(MACHINE * mp, int fold)
+{
+    STATE *p;
+    int k;
+
+    if (mp->start == mp->stop)
+	return 0;
+    for (p = mp->start; p < mp->stop; ++p) {
+	switch (p->s_type) {
+	case M_STR:
+	    if (p->s_len == 0)
+		return 0;
+	    for (k = 0; k < p->s_len; ++k) {
+		int c = (UChar) p->s_data.str[k];
+
+		/* REtest() compares strings with strncmp() */
+		if (c == 0)
+		    return 0;
+		if (fold && (tolower(c) != c || toupper(c) != c))
+		    return 0;
+	    }
+	    break;
+	case M_CLASS:
+	    if (trie_class(p->s_data.bvp, fold) < 0)
+		return 0;
+	    break;
+	default:
+	    return 0;
+	}
+    }
+    return 1;
+}
+
+/* nonzero if machine m is just an M_TRIE */
+static int
+trie_is(MACHINE * mp)
+{
+    return (mp->start->s_type == M_TRIE && mp->stop == mp->start + 1);
+}
+
+static void
+trie_free_machine(MACHINE * mp)
+{
+    STATE *p;
+
+    for (p = mp->start; p < mp->stop; p++) {
+	if (p->s_type == M_STR)
+	    RE_free(p->s_data.str);
+    }
+    RE_free(mp->start);
+}
+
+static TRIE *
+trie_new(int fold)
+{
+    TRIE *t = (TRIE *) RE_malloc(sizeof(TRIE));
+    int c;
+
+    memset(t, 0, sizeof(TRIE));
+    t->links = 1;
+    t->nodes = 1;
+    t->mask = 63;
+    t->keys = (unsigned *) RE_malloc((t->mask + 1) * sizeof(unsigned));
+    t->kids = (int *) RE_malloc((t->mask + 1) * sizeof(int));
+    memset(t->keys, 0, (t->mask + 1) * sizeof(unsigned));
+    t->flags_size = 64;
+    t->flags = (UChar *) RE_malloc((size_t) t->flags_size);
+    t->flags[0] = 0;
+    for (c = 0; c < 256; ++c)
+	t->map[c] = (UChar) trie_map(fold, c);
+    t->saved = (MACHINE *) RE_malloc(TRIE_MIN * sizeof(MACHINE));
+    return t;
+}
+
+static void
+trie_forget(TRIE * t)
+{
+    int n;
+
+    if (t->saved != 0) {
+	for (n = 0; n < t->words; ++n)
+	    trie_free_machine(t->saved + n);
+	RE_free(t->saved);
+	t->saved = 0;
+    }
+}
+
+void
+RE_trie_free(TRIE * t)
+{
+    if (--(t->links) > 0)
+	return;
+    trie_forget(t);
+    RE_free(t->keys);
+    RE_free(t->kids);
+    RE_free(t->flags);
+    RE_free(t);
+}
+
+size_t
+RE_trie_size(TRIE * t)
+{
+    return (sizeof(TRIE)
+	    + (size_t) (t->mask + 1) * (sizeof(unsigned) + sizeof(int))
+	      + (size_t) t->flags_size);
+}
+
+/*
+ * Look up a child by its key.  Return the child, or 0 and set *hp to the
+ * empty slot where it would go.
+ */
+static int
+trie_find(TRIE * t, unsigned key, unsigned *hp)
+{
+    unsigned h;
+
+    for (h = TRIE_HASH(key) & t->mask; t->keys[h] != 0; h = (h + 1) & t->mask) {
+	if (t->keys[h] == key)
+	    return t->kids[h];
+    }
+    *hp = h;
+    return 0;
+}
+
+/* the child of node by byte c, or 0 */
+int
+RE_trie_next(TRIE * t, int node, int c)
+{
+    unsigned h;
+
+    c = t->map[c];
+    if (node == 0)
+	return t->root[c];
+    return trie_find(t, ((unsigned) node << 8) + (unsigned) c, &h);
+}
+
+/* double the size of the hash table */
+static void
+trie_grow(TRIE * t)
+{
+    unsigned *keys = t->keys;
+    int *kids = t->kids;
+    unsigned size = t->mask + 1;
+    unsigned n;
+    unsigned h = 0;
+
+    t->mask = 2 * size - 1;
+    t->keys = (unsigned *) RE_malloc(2 * size * sizeof(unsigned));
+    t->kids = (int *) RE_malloc(2 * size * sizeof(int));
+    memset(t->keys, 0, 2 * size * sizeof(unsigned));
+    for (n = 0; n < size; ++n) {
+	if (keys[n] != 0) {
+	    (void) trie_find(t, keys[n], &h);
+	    t->keys[h] = keys[n];
+	    t->kids[h] = kids[n];
+	}
+    }
+    RE_free(keys);
+    RE_free(kids);
+}
+
+static int
+trie_node(TRIE * t)
+{
+    if (t->nodes >= TRIE_NODES)
+	RE_error_trap(MEMORY_FAILURE);
+    if (t->nodes == t->flags_size) {
+	t->flags_size *= 2;
+	t->flags = (UChar *) RE_realloc(t->flags, (size_t) t->flags_size);
+    }
+    t->flags[t->nodes] = 0;
+    return t->nodes++;
+}
+
+/* the child of node by the mapped byte c, made if there is none */
+static int
+trie_add(TRIE * t, int node, int c)
+{
+    unsigned key = ((unsigned) node << 8) + (unsigned) c;
+    unsigned h = 0;
+    int kid;
+    int b;
+
+    if (node == 0) {
+	if ((kid = t->root[c]) == 0) {
+	    kid = trie_node(t);
+	    t->root[c] = kid;
+	    for (b = 0; b < 256; ++b) {
+		if (t->map[b] == c)
+		    t->first.bv[b >> 3] |= (UChar) (1 << (b & 7));
+	    }
+	    RE_class_init(&t->first);
+	}
+    } else if ((kid = trie_find(t, key, &h)) == 0) {
+	if (2 * (t->used + 1) > t->mask + 1) {
+	    trie_grow(t);
+	    (void) trie_find(t, key, &h);
+	}
+	kid = trie_node(t);
+	t->keys[h] = key;
+	t->kids[h] = kid;
+	t->used++;
+    }
+    t->flags[node] |= TRIE_KIDS;
+    return kid;
+}
+
+/*
+ * Add the word which machine m matches, then keep m while the list is
+ * short, or free it.
+ */
+static void
+trie_insert(TRIE * t, MACHINE * mp, int fold)
+{
+    STATE *p;
+    int node = 0;
+    int len = 0;
+    int k;
+
+    for (p = mp->start; p < mp->stop; ++p) {
+	if (p->s_type == M_STR) {
+	    for (k = 0; k < p->s_len; ++k)
+		node = trie_add(t, node, t->map[(UChar) p->s_data.str[k]]);
+	    len += p->s_len;
+	} else {
+	    node = trie_add(t, node, trie_class(p->s_data.bvp, fold));
+	    len++;
+	}
+    }
+    t->flags[node] |= TRIE_FINAL;
+    if (len > t->depth)
+	t->depth = len;
+    if (len > trie_ends_size) {
+	trie_ends = (char **) RE_realloc(trie_ends, (size_t) len * sizeof(char *));
+	trie_ends_size = len;
+    }
+
+    if (t->saved != 0 && t->words < TRIE_MIN) {
+	t->saved[t->words] = *mp;
+    } else {
+	trie_free_machine(mp);
+	trie_forget(t);
+    }
+    t->words++;
+}
+
+/*
+ * Replace m by m|n if both are literals, or m is already a trie, and return
+ * nonzero.  Otherwise, finish any trie in m or n, and return 0 for
+ * RE_or() to do it.
+ */
+int
+RE_trie_or(MACHINE * mp, MACHINE * np, int fold)
+{
+    TRIE *t;
+
+    if (!trie_word(np, fold)
+	|| !(trie_is(mp) || trie_word(mp, fold))) {
+	RE_trie_done(mp);
+	RE_trie_done(np);
+	return 0;
+    }
+    if (trie_is(mp)) {
+	t = mp->start->s_data.trie;
+    } else {
+	t = trie_new(fold);
+	trie_insert(t, mp, fold);
+	mp->start = (STATE *) RE_malloc(2 * STATESZ);
+	mp->stop = mp->start + 1;
+	mp->start->s_type = M_TRIE;
+	mp->start->s_data.trie = t;
+	mp->stop->s_type = M_ACCEPT;
+    }
+    trie_insert(t, np, fold);
+    return 1;
+}
+
+/*
+ * Called when m is used by anything but another |.  If it is a trie of
+ * only a few words, replace it by their alternation.
+ */
+void
+RE_trie_done(MACHINE * mp)
+{
+    TRIE *t;
+    MACHINE x;
+    int n;
+
+    if (!trie_is(mp) || (t = mp->start->s_data.trie)->saved == 0)
+	return;
+    x = t->saved[0];
+    for (n = 1; n < t->words; ++n)
+	RE_or(&x, t->saved + n);
+    RE_free(t->saved);
+    t->saved = 0;
+    RE_trie_free(t);
+    RE_free(mp->start);
+    *mp = x;
+}
+
+/*
+ * Find the words of t which begin at s.  Return how many, and set *endsp
+ * to a list of where they end, shortest first.  Set *cutp if the string
+ * ends where a longer word could go on.
+ */
+int
+RE_trie_walk(TRIE * t, char *s, char *str_end, char ***endsp, int *cutp)
+{
+    int node = 0;
+    int count = 0;
+
+    *endsp = trie_ends;
+    *cutp = 0;
+    while (s < str_end) {
+	if ((node = RE_trie_next(t, node, (UChar) * s++)) == 0)
+	    return count;
+	if (t->flags[node] & TRIE_FINAL)
+	    trie_ends[count++] = s;
+	if (!(t->flags[node] & TRIE_KIDS))
+	    return count;
+    }
+    *cutp = 1;
+    return count;
+}
+
+#ifdef NO_LEAKS
+void
+RE_trie_leaks(void)
+{
+    if (trie_ends) {
+	RE_free(trie_ends);
+	trie_ends = 0;
+	trie_ends_size = 0;
+    }
+}
+#endif
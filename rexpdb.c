@@ -45,7 +45,10 @@ static const char *xlat[] =
     "M_2JB",
     "M_SAVE_POS",
     "M_2JC",
-    "M_ACCEPT"};
+    "M_ACCEPT",
+    "M_OPEN",
+    "M_CLOSE",
+    "M_TRIE"};
 
 void
 REmprint(PTR m, FILE *f)
@@ -75,8 +78,13 @@ REmprint(PTR m, FILE *f)
 	case M_2JA:
 	case M_2JB:
 	case M_2JC:
+	case M_OPEN:
+	case M_CLOSE:
 	    fprintf(f, "%d", p->s_data.jump);
 	    break;
+	case M_TRIE:
+	    fprintf(f, "%d words", p->s_data.trie->words);
+	    break;
 	case M_CLASS:
 	    {
 		UChar *q = (UChar *) p->s_data.bvp;
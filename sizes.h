@@ -122,6 +122,9 @@ typedef unsigned UInt;
 #define  MAX_BUFFS	((int)(0x10000L/BUFFSZ) - 1)
 #endif
 
+#define  MAX_CHUNK	0x4000000L
+  /* largest -W chunk, 64Mb; the buffer still grows past it */
+
 #define  HASH_PRIME  53
 #define  A_HASH_PRIME 199
 
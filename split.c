@@ -155,7 +155,7 @@ re_pos_match(char *s, size_t str_len, PTR re, size_t *lenp)
 {
     char *result = 0;
 
-    while (str_len && (s = REmatch(s, str_len, cast_to_re(re), lenp))) {
+    while (str_len && (s = re_match(re, RE_SPLIT, s, str_len, lenp))) {
 	if (*lenp) {
 	    result = s;
 	    break;
@@ -170,6 +170,30 @@ re_pos_match(char *s, size_t str_len, PTR re, size_t *lenp)
     return result;
 }
 
+/* re_pos_match for a string which may grow: the search starts at "from",
+ * and *partp is set to where it must resume if more text is appended
+ * (see REmatch_resume).
+ */
+char *
+re_pos_resume(char *str, size_t str_len, char *from, PTR re,
+	      size_t *lenp, char **partp)
+{
+    char *s = from;
+    char *end = str + str_len;
+
+    if (s < end && (s = re_match_resume(re, RE_SPLIT, str, str_len,
+					lenp, from, partp))) {
+	if (*lenp)
+	    return s;
+	/* null matches may depend on where the search began, so after
+	   one, the whole string must be searched again */
+	*partp = str;
+	if (*s != 0 && s + 1 < end)
+	    return re_pos_match(s + 1, (size_t) (end - s - 1), re, lenp);
+    }
+    return (char *) 0;
+}
+
 /*
  *  We've overflowed split_buff[], put the rest on the split_ov_list.
  *
@@ -213,13 +237,11 @@ re_ov_split(char *s, size_t slen, PTR re)
 	slen = (size_t) (limit - s)
 
 size_t
-re_split(STRING * s_param, PTR re)
+re_split(char *s, size_t slen, PTR re)
 {
-    char *limit = s_param->str + s_param->len;
-    char *s = s_param->str;
+    char *limit = s + slen;
     char *t;
     size_t i = 0;
-    size_t slen = s_param->len;
     size_t mlen;
     int lcnt = MAX_SPLIT / 3;
 
@@ -279,6 +301,66 @@ null_split(char *s, size_t slen)
     return cnt;
 }
 
+/*
+ * Split no more than "most" pieces from the front of s, by FS, into
+ * split_buff[], for split_field0_to().  Return how many, and set *restp to
+ * where the rest of s begins, or to null if there is no more.  Splitting
+ * the rest by space_split(), etc., then gives the remaining fields.
+ */
+size_t
+split_front(char *s, size_t slen, size_t most, char **restp)
+{
+    char *limit = s + slen;
+    char *back = limit;		/* for EAT_NON_SPACE() */
+    char *q;
+    size_t i = 0;
+    size_t mlen;
+
+    switch (fs_shadow.type) {
+    case C_SNULL:		/* FS == "" */
+	while (i < most && s < limit) {
+	    split_buff[i] = new_STRING0((size_t) 1);
+	    split_buff[i++]->str[0] = *s++;
+	}
+	if (s == limit)
+	    s = 0;
+	break;
+
+    case C_SPACE:
+	while (i < most) {
+	    EAT_SPACE();
+	    if (*s == 0) {
+		s = 0;
+		break;
+	    }
+	    q = s++;
+	    EAT_NON_SPACE();
+	    split_buff[i++] = new_STRING1(q, (size_t) (s - q));
+	}
+	if (s != 0) {
+	    EAT_SPACE();
+	    if (*s == 0)
+		s = 0;
+	}
+	break;
+
+    default:
+	while (i < most) {
+	    q = re_pos_match(s, (size_t) (limit - s), fs_shadow.ptr, &mlen);
+	    if (q == 0) {
+		split_buff[i++] = new_STRING1(s, (size_t) (limit - s));
+		s = 0;
+		break;
+	    }
+	    split_buff[i++] = new_STRING1(s, (size_t) (q - s));
+	    s = q + mlen;
+	}
+	break;
+    }
+    *restp = s;
+    return i;
+}
+
 /*  split(s, X, r)
  *  split s into array X on r
  *
@@ -303,7 +385,7 @@ bi_split(CELL * sp)
     } else {
 	switch ((sp + 2)->type) {
 	case C_RE:
-	    cnt = re_split(string(sp), (sp + 2)->ptr);
+	    cnt = re_split(string(sp)->str, string(sp)->len, (sp + 2)->ptr);
 	    break;
 
 	case C_SPACE:
@@ -113,4 +113,4 @@ scan.obj : array.h code.h config.h field.h files.h fin.h init.h mawk.h memory.h
 split.obj : array.h bi_funct.h bi_vars.h config.h field.h mawk.h memory.h nstd.h parse.h regexp.h repl.h scan.h scancode.h sizes.h symtype.h types.h zmalloc.h
 version.obj : array.h config.h init.h mawk.h nstd.h patchlev.h sizes.h symtype.h types.h
 zmalloc.obj : config.h mawk.h nstd.h sizes.h types.h zmalloc.h
-regexp.obj : rexpdb.c rexp4.c rexp2.c regexp_system.c sizes.h mawk.h rexp0.c rexp1.c config.h rexp.h regexp.h nstd.h rexp3.c rexp.c field.h
+regexp.obj : rexpdb.c rexp5.c rexp6.c rexp7.c rexp8.c rexp9.c rexp4.c rexp2.c regexp_system.c sizes.h mawk.h rexp0.c rexp1.c config.h rexp.h regexp.h nstd.h rexp3.c rexp.c field.h